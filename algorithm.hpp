@@ -13,7 +13,182 @@
 #ifndef _ALGORYTHME_HPP_
 #define _ALGORYTHME_HPP_
 
+#include <cstring>
+
+#include "random_access_iterator.hpp"
+#include "simd.hpp"
+#include "type_traits.hpp"
+
 namespace ft {
+
+    /*
+    Ramène un itérateur contigu à son pointeur sous-jacent, afin que les
+    intervalles de ft::random_access_iterator et de pointeurs partagent les
+    mêmes implémentations spécialisées. Les autres itérateurs sont inchangés.
+    */
+
+    template < class Iterator >
+    struct iterator_unwrapper {
+        typedef Iterator type;
+
+        static type unwrap(Iterator it) { return it; }
+    };
+
+    template < class T >
+    struct iterator_unwrapper< ft::random_access_iterator< T > > {
+        typedef T* type;
+
+        static type unwrap(ft::random_access_iterator< T > it) { return it.base(); }
+    };
+
+    /*
+    Stratégies de comparaison d'intervalles, choisies à la compilation :
+    boucle générique, memcmp, ou noyaux vectoriels de simd.hpp.
+    */
+
+    struct generic_compare_tag {};
+    struct memcmp_compare_tag {};
+    struct simd_compare_tag {};
+
+    /*
+    Stratégie de ft::equal : seuls des pointeurs vers un même type profitent
+    de memcmp (égalité octet par octet) ou des noyaux vectoriels (flottants).
+    */
+
+    template < class Iterator1, class Iterator2 >
+    struct equal_strategy {
+        typedef generic_compare_tag type;
+    };
+
+    template < class T1, class T2 >
+    struct equal_strategy< T1*, T2* > {
+        typedef typename ft::remove_cv< T1 >::type value_type;
+        static const bool same_type =
+            ft::is_same< value_type, typename ft::remove_cv< T2 >::type >::value;
+
+        typedef typename ft::conditional<
+            same_type && ft::is_bytewise_equality_comparable< value_type >::value,
+            memcmp_compare_tag,
+            typename ft::conditional< same_type && ft::simd::has_kernels< value_type >::value,
+                                    simd_compare_tag, generic_compare_tag >::type >::type type;
+    };
+
+    /*
+    Stratégie de ft::lexicographical_compare : memcmp pour les octets non
+    signés, noyaux vectoriels pour les entiers de 32 / 64 bits et les flottants.
+    */
+
+    template < class Iterator1, class Iterator2 >
+    struct less_strategy {
+        typedef generic_compare_tag type;
+    };
+
+    template < class T1, class T2 >
+    struct less_strategy< T1*, T2* > {
+        typedef typename ft::remove_cv< T1 >::type value_type;
+        static const bool same_type =
+            ft::is_same< value_type, typename ft::remove_cv< T2 >::type >::value;
+
+        typedef typename ft::conditional<
+            same_type && ft::is_bytewise_less_comparable< value_type >::value,
+            memcmp_compare_tag,
+            typename ft::conditional< same_type && ft::simd::has_kernels< value_type >::value,
+                                    simd_compare_tag, generic_compare_tag >::type >::type type;
+    };
+
+    /*
+    Implémentation générique de ft::equal : compare élément par élément.
+    */
+
+    template < class InputIterator1, class InputIterator2 >
+    bool equal_impl(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                    generic_compare_tag) {
+        for (; first1 != last1; ++first1, (void)++first2)
+            if (!(*first1 == *first2))
+                return false;
+        return true;
+    }
+
+    /*
+    Intervalles contigus comparables octet par octet : un seul memcmp.
+    */
+
+    template < class T1, class T2 >
+    bool equal_impl(T1* first1, T1* last1, T2* first2, memcmp_compare_tag) {
+        std::size_t n = last1 - first1;
+        return n == 0 || std::memcmp(first1, first2, n * sizeof(T1)) == 0;
+    }
+
+    /*
+    Intervalles contigus de flottants : noyau vectoriel qui cherche
+    le premier élément différent.
+    */
+
+    template < class T1, class T2 >
+    bool equal_impl(T1* first1, T1* last1, T2* first2, simd_compare_tag) {
+        typedef typename ft::remove_cv< T1 >::type value_type;
+        std::size_t n = last1 - first1;
+        return ft::simd::active_kernels< value_type >().find_unequal(first1, first2, n) == n;
+    }
+
+    /*
+    Implémentation générique de ft::lexicographical_compare.
+    */
+
+    template < class InputIterator1, class InputIterator2 >
+    bool lexicographical_compare_impl(InputIterator1 first1, InputIterator1 last1,
+                                    InputIterator2 first2, InputIterator2 last2,
+                                    generic_compare_tag) {
+        while (first1 != last1) {
+            if (first2 == last2 || *first2 < *first1)
+                return false;
+            else if (*first1 < *first2)
+                return true;
+            ++first1;
+            ++first2;
+        }
+        return (first2 != last2);
+    }
+
+    /*
+    Intervalles contigus d'octets non signés : memcmp sur le préfixe commun,
+    puis comparaison des longueurs.
+    */
+
+    template < class T1, class T2 >
+    bool lexicographical_compare_impl(T1* first1, T1* last1, T2* first2, T2* last2,
+                                    memcmp_compare_tag) {
+        std::size_t len1 = last1 - first1;
+        std::size_t len2 = last2 - first2;
+        std::size_t n = len1 < len2 ? len1 : len2;
+        if (n != 0) {
+            int cmp = std::memcmp(first1, first2, n);
+            if (cmp != 0)
+                return cmp < 0;
+        }
+        return len1 < len2;
+    }
+
+    /*
+    Intervalles contigus d'entiers ou de flottants : le noyau vectoriel
+    trouve le premier élément qui n'est pas équivalent, puis on compare
+    cet élément seul.
+    */
+
+    template < class T1, class T2 >
+    bool lexicographical_compare_impl(T1* first1, T1* last1, T2* first2, T2* last2,
+                                    simd_compare_tag) {
+        typedef typename ft::remove_cv< T1 >::type value_type;
+        std::size_t len1 = last1 - first1;
+        std::size_t len2 = last2 - first2;
+        std::size_t n = len1 < len2 ? len1 : len2;
+        std::size_t i =
+            ft::simd::active_kernels< value_type >().find_less_greater(first1, first2, n);
+        if (i < n)
+            return first1[i] < first2[i];
+        return len1 < len2;
+    }
+
     /*
     test si les éléments entre deux intervalles sont égales
     Compare les éléments de l'intervalle [first1,last1) avec ceux de l'intervalle
@@ -23,10 +198,12 @@ namespace ft {
 
     template < class InputIterator1, class InputIterator2 >
     bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
-        for (; first1 != last1; ++first1, (void)++first2)
-            if (!(*first1 == *first2))
-                return false;
-        return true;
+        typedef ft::iterator_unwrapper< InputIterator1 > unwrapper1;
+        typedef ft::iterator_unwrapper< InputIterator2 > unwrapper2;
+        return ft::equal_impl(
+            unwrapper1::unwrap(first1), unwrapper1::unwrap(last1), unwrapper2::unwrap(first2),
+            typename ft::equal_strategy< typename unwrapper1::type,
+                                        typename unwrapper2::type >::type());
     }
 
     /*
@@ -66,15 +243,13 @@ namespace ft {
     template < class InputIterator1, class InputIterator2 >
     bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
                                 InputIterator2 first2, InputIterator2 last2) {
-        while (first1 != last1) {
-            if (first2 == last2 || *first2 < *first1)
-                return false;
-            else if (*first1 < *first2)
-                return true;
-            ++first1;
-            ++first2;
-        }
-        return (first2 != last2);
+        typedef ft::iterator_unwrapper< InputIterator1 > unwrapper1;
+        typedef ft::iterator_unwrapper< InputIterator2 > unwrapper2;
+        return ft::lexicographical_compare_impl(
+            unwrapper1::unwrap(first1), unwrapper1::unwrap(last1), unwrapper2::unwrap(first2),
+            unwrapper2::unwrap(last2),
+            typename ft::less_strategy< typename unwrapper1::type,
+                                        typename unwrapper2::type >::type());
     }
 
     /* Renvoie true si l'intervalle [first1,last1] est inférieur à, lexicographiquement,
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   algorithm_bench.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "algorithm.hpp"
+
+#include <iostream>
+#include <vector>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+namespace {
+    /**
+     * @brief Renvoie le temps moyen en ns d'un appel à fn(),
+     * répété jusqu'à traiter environ 256 Mo.
+     */
+    template < class Fn >
+    double time_per_call(Fn fn, std::size_t bytes) {
+        std::size_t reps = (256u << 20) / bytes;
+        if (reps == 0) {
+            reps = 1;
+        }
+        volatile bool sink = false;
+        double start = bench::now_ns();
+        for (std::size_t i = 0; i < reps; ++i) {
+            sink = fn();
+        }
+        (void)sink;
+        return (bench::now_ns() - start) / reps;
+    }
+
+    /* Intervalles contigus, unwrap vers des pointeurs : chemin memcmp */
+    struct memcmp_equal {
+        const ft::vector< unsigned char >* a;
+        const ft::vector< unsigned char >* b;
+        bool operator()() const { return ft::equal(a->begin(), a->end(), b->begin()); }
+    };
+
+    struct memcmp_less {
+        const ft::vector< unsigned char >* a;
+        const ft::vector< unsigned char >* b;
+        bool operator()() const {
+            return ft::lexicographical_compare(a->begin(), a->end(), b->begin(), b->end());
+        }
+    };
+
+    /* Itérateurs std::vector, non déballés : boucle générique */
+    struct loop_equal {
+        const std::vector< unsigned char >* a;
+        const std::vector< unsigned char >* b;
+        bool operator()() const { return ft::equal(a->begin(), a->end(), b->begin()); }
+    };
+
+    struct loop_less {
+        const std::vector< unsigned char >* a;
+        const std::vector< unsigned char >* b;
+        bool operator()() const {
+            return ft::lexicographical_compare(a->begin(), a->end(), b->begin(), b->end());
+        }
+    };
+
+    /* Noyau choisi au démarrage, appelé via ft::lexicographical_compare */
+    template < class T >
+    struct simd_less {
+        const ft::vector< T >* a;
+        const ft::vector< T >* b;
+        bool operator()() const {
+            return ft::lexicographical_compare(a->begin(), a->end(), b->begin(), b->end());
+        }
+    };
+
+    /* Noyau scalaire, pour mesurer le gain du dispatch */
+    template < class T >
+    struct scalar_less {
+        const ft::vector< T >* a;
+        const ft::vector< T >* b;
+        bool operator()() const {
+            std::size_t n = a->size();
+            std::size_t i = ft::simd::find_less_greater_scalar(&(*a)[0], &(*b)[0], n);
+            return i < n && (*a)[i] < (*b)[i];
+        }
+    };
+
+    template < class T >
+    void bench_simd_less(const char* type_name) {
+        const std::size_t count = 1u << 20;
+        ft::vector< T > a(count, T(1));
+        ft::vector< T > b(count, T(1));
+        b[count - 1] = T(2);
+
+        simd_less< T > fast = {&a, &b};
+        scalar_less< T > slow = {&a, &b};
+        std::size_t bytes = count * sizeof(T);
+        double fast_ns = time_per_call(fast, bytes);
+        double slow_ns = time_per_call(slow, bytes);
+        std::cout << "\t lexicographical_compare<" << type_name << "> " << count
+                << " elements: simd " << fast_ns << " ns (" << bytes / fast_ns
+                << " GB/s), scalar " << slow_ns << " ns (" << bytes / slow_ns << " GB/s)"
+                << std::endl;
+    }
+
+    void report(const char* name, std::size_t bytes, double ns) {
+        std::cout << "\t " << name << " " << (bytes >> 10) << " KB: " << ns << " ns ("
+                << bytes / ns << " GB/s)" << std::endl;
+    }
+}
+
+void bench_algorithm(void) {
+    std::cout << "Bench: bytewise compare" << std::endl;
+    for (std::size_t bytes = 1u << 10; bytes <= (64u << 20); bytes <<= 2) {
+        ft::vector< unsigned char > ft_a(bytes, 42);
+        ft::vector< unsigned char > ft_b(bytes, 42);
+        std::vector< unsigned char > std_a(bytes, 42);
+        std::vector< unsigned char > std_b(bytes, 42);
+
+        memcmp_equal fast_eq = {&ft_a, &ft_b};
+        loop_equal slow_eq = {&std_a, &std_b};
+        memcmp_less fast_lt = {&ft_a, &ft_b};
+        loop_less slow_lt = {&std_a, &std_b};
+
+        report("ft::equal memcmp", bytes, time_per_call(fast_eq, bytes));
+        report("ft::equal loop  ", bytes, time_per_call(slow_eq, bytes));
+        report("ft::lexicographical_compare memcmp", bytes, time_per_call(fast_lt, bytes));
+        report("ft::lexicographical_compare loop  ", bytes, time_per_call(slow_lt, bytes));
+    }
+
+    static const char* isa_names[] = {"scalar", "sse2", "avx2", "avx512"};
+    std::cout << "Bench: simd compare (" << isa_names[ft::simd::active_isa()] << ")"
+            << std::endl;
+    bench_simd_less< int >("int");
+    bench_simd_less< long >("long");
+    bench_simd_less< float >("float");
+    bench_simd_less< double >("double");
+}
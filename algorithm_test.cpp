@@ -11,10 +11,13 @@
 /* ************************************************************************** */
 
 #include "algorithm.hpp"
+#include "vector.hpp"
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <vector>
 
 bool mycomp(char c1, char c2) { return std::tolower(c1) < std::tolower(c2); }
@@ -48,8 +51,150 @@ void test_equal(void) {
             ft::equal(myvector.begin(), myvector.end(), myints, mypredicate));
 }
 
+void test_bytewise_compare(void) {
+    std::cout << "\t bytewise equal / lexicographical_compare" << std::endl;
+
+    unsigned char ubytes1[] = {1, 2, 200, 4};
+    unsigned char ubytes2[] = {1, 2, 100, 4, 5};
+    assert(std::equal(ubytes1, ubytes1 + 4, ubytes2) ==
+            ft::equal(ubytes1, ubytes1 + 4, ubytes2));
+    assert(std::lexicographical_compare(ubytes1, ubytes1 + 4, ubytes2, ubytes2 + 5) ==
+            ft::lexicographical_compare(ubytes1, ubytes1 + 4, ubytes2, ubytes2 + 5));
+    assert(std::lexicographical_compare(ubytes2, ubytes2 + 2, ubytes1, ubytes1 + 4) ==
+            ft::lexicographical_compare(ubytes2, ubytes2 + 2, ubytes1, ubytes1 + 4));
+
+    char chars1[] = {'a', static_cast< char >(-3), 'c'};
+    char chars2[] = {'a', 'b', 'c'};
+    assert(std::lexicographical_compare(chars1, chars1 + 3, chars2, chars2 + 3) ==
+            ft::lexicographical_compare(chars1, chars1 + 3, chars2, chars2 + 3));
+
+    int ints1[] = {1, -2, 3};
+    int ints2[] = {1, 2, 3};
+    ft::vector< int > vec1(ints1, ints1 + 3);
+    ft::vector< int > vec2(ints2, ints2 + 3);
+    const ft::vector< int >& cvec1 = vec1;
+    assert(!ft::equal(vec1.begin(), vec1.end(), vec2.begin()));
+    assert(ft::equal(cvec1.begin(), cvec1.end(), ints1));
+    assert(ft::lexicographical_compare(vec1.begin(), vec1.end(), vec2.begin(), vec2.end()));
+    assert(vec1 < vec2 && vec1 != vec2);
+
+    ft::vector< unsigned char > buf1(1024, 7);
+    ft::vector< unsigned char > buf2(buf1);
+    assert(buf1 == buf2 && !(buf1 < buf2));
+    buf2[1000] = 8;
+    assert(buf1 != buf2 && buf1 < buf2);
+    buf2.pop_back();
+    assert(buf2 < buf1 || buf1 < buf2);
+}
+
+template < class T >
+void check_kernels(ft::simd::isa level) {
+    ft::simd::kernels< T > k = ft::simd::kernel_selector< T >::select(level);
+    std::vector< T > a(100);
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = static_cast< T >(i * 3 + 1);
+    }
+    for (size_t len = 0; len <= a.size(); ++len) {
+        std::vector< T > b(a);
+        assert(k.find_unequal(&a[0], &b[0], len) == len);
+        assert(k.find_less_greater(&a[0], &b[0], len) == len);
+        for (size_t pos = 0; pos < len; pos += 7) {
+            b[pos] = static_cast< T >(a[pos] + 1);
+            assert(k.find_unequal(&a[0], &b[0], len) == pos);
+            assert(k.find_less_greater(&a[0], &b[0], len) == pos);
+            b[pos] = a[pos];
+        }
+    }
+}
+
+template < class T >
+void check_nan_kernels(ft::simd::isa level) {
+    ft::simd::kernels< T > k = ft::simd::kernel_selector< T >::select(level);
+    std::vector< T > a(40, 1);
+    std::vector< T > b(40, 1);
+    a[20] = std::numeric_limits< T >::quiet_NaN();
+    b[20] = std::numeric_limits< T >::quiet_NaN();
+    b[30] = 2;
+    assert(k.find_unequal(&a[0], &b[0], a.size()) == 20);
+    assert(k.find_less_greater(&a[0], &b[0], a.size()) == 30);
+    b[30] = 1;
+    a[10] = T(-0.0);
+    b[10] = T(0.0);
+    assert(k.find_unequal(&a[0], &b[0], 20) == 20);
+}
+
+template < class T >
+void check_search_kernels(ft::simd::isa level) {
+    ft::simd::search_kernels< T > k = ft::simd::search_kernel_selector< T >::select(level);
+    std::vector< T > keys(70);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        keys[i] = static_cast< T >(i * 2) - 40;
+    }
+    for (size_t len = 0; len <= keys.size(); len += 3) {
+        for (T k_value = -43; k_value < 102; ++k_value) {
+            size_t less = std::lower_bound(keys.begin(), keys.begin() + len, k_value) - keys.begin();
+            size_t upper = std::upper_bound(keys.begin(), keys.begin() + len, k_value) - keys.begin();
+            assert(k.count_less(&keys[0], len, k_value) == less);
+            assert(k.count_greater(&keys[0], len, k_value) == len - upper);
+        }
+    }
+}
+
+template < class T >
+void check_simd_compare(void) {
+    std::vector< T > std_a(333);
+    for (size_t i = 0; i < std_a.size(); ++i) {
+        std_a[i] = static_cast< T >(i);
+    }
+    std::vector< T > std_b(std_a);
+    ft::vector< T > ft_a(std_a.begin(), std_a.end());
+    ft::vector< T > ft_b(std_b.begin(), std_b.end());
+    assert((ft_a == ft_b) == (std_a == std_b));
+    assert((ft_a < ft_b) == (std_a < std_b));
+
+    std_b[250] = static_cast< T >(std_b[250] - 1);
+    ft_b[250] = std_b[250];
+    assert((ft_a == ft_b) == (std_a == std_b));
+    assert((ft_a < ft_b) == (std_a < std_b));
+    assert((ft_b < ft_a) == (std_b < std_a));
+
+    std_b.pop_back();
+    ft_b.pop_back();
+    std_b[250] = std_a[250];
+    ft_b[250] = ft_a[250];
+    assert((ft_a < ft_b) == (std_a < std_b));
+    assert((ft_b < ft_a) == (std_b < std_a));
+}
+
+void test_simd_compare(void) {
+    std::cout << "\t simd kernels" << std::endl;
+
+    const ft::simd::isa levels[] = {ft::simd::ISA_SCALAR, ft::simd::ISA_SSE2,
+                                    ft::simd::ISA_AVX2, ft::simd::ISA_AVX512};
+    for (size_t i = 0; i < 4 && levels[i] <= ft::simd::active_isa(); ++i) {
+        check_kernels< int >(levels[i]);
+        check_kernels< unsigned int >(levels[i]);
+        check_kernels< long >(levels[i]);
+        check_kernels< unsigned long >(levels[i]);
+        check_kernels< float >(levels[i]);
+        check_kernels< double >(levels[i]);
+        check_nan_kernels< float >(levels[i]);
+        check_nan_kernels< double >(levels[i]);
+        check_search_kernels< int >(levels[i]);
+        check_search_kernels< long >(levels[i]);
+    }
+
+    check_simd_compare< int >();
+    check_simd_compare< long >();
+    check_simd_compare< unsigned long >();
+    check_simd_compare< float >();
+    check_simd_compare< double >();
+}
+
 void test_algorithm(void) {
     std::cout << "Test: algorithm" << std::endl;
     test_equal();
     test_lexicographical_compare();
+    test_bytewise_compare();
+    test_simd_compare();
 }
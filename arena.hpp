@@ -0,0 +1,285 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _ARENA_HPP_
+#define _ARENA_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+#include "memory.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Zone d'allocation monotone : chaque allocation avance un
+     * curseur dans le bloc courant, la libération individuelle ne fait
+     * rien, et release rend toute la mémoire d'un coup.
+     * Quand le bloc courant est épuisé, un bloc au moins deux fois plus
+     * grand est obtenu d'operator new et chaîné aux précédents.
+     */
+    class arena {
+        private:
+            /**
+             * @brief En-tête placé au début de chaque bloc obtenu d'operator new.
+             */
+            struct block {
+                block* next;
+                std::size_t size;
+            };
+
+            /* En-tête arrondi pour que le premier octet utile soit aligné */
+            static const std::size_t HEADER_SIZE = (sizeof(block) + 15) & ~static_cast< std::size_t >(15);
+
+            char* _cursor;
+            char* _limit;
+            block* _blocks;
+            std::size_t _next_size;
+
+        public:
+            /**
+             * @brief Construit une arène vide ; le premier bloc, de
+             * initial_size octets utiles, n'est obtenu qu'à la première
+             * allocation.
+             */
+            explicit arena(std::size_t initial_size = 4096)
+                : _cursor(u_nullptr),
+                _limit(u_nullptr),
+                _blocks(u_nullptr),
+                _next_size(initial_size ? initial_size : 1) {}
+
+            ~arena() { this->_free_blocks(u_nullptr); }
+
+            /**
+             * @brief Renvoie bytes octets alignés sur align (une puissance de
+             * deux) en avançant le curseur.
+             */
+            void* allocate(std::size_t bytes, std::size_t align) {
+                char* p = this->_align(this->_cursor, align);
+                /* Le remplissage d'alignement peut à lui seul dépasser _limit */
+                if (!this->_cursor || p > this->_limit ||
+                    bytes > static_cast< std::size_t >(this->_limit - p)) {
+                    this->_grow(bytes + align);
+                    p = this->_align(this->_cursor, align);
+                }
+                this->_cursor = p + bytes;
+                return p;
+            }
+
+            /**
+             * @brief Ne fait rien : la mémoire n'est rendue que par release.
+             */
+            void deallocate(void*, std::size_t) {}
+
+            /**
+             * @brief Agrandit en place le bloc p de old_bytes à new_bytes s'il
+             * est la dernière allocation de l'arène et que le bloc courant a
+             * la place.
+             */
+            bool try_extend(void* p, std::size_t old_bytes, std::size_t new_bytes) {
+                char* start = static_cast< char* >(p);
+                if (start + old_bytes != this->_cursor ||
+                    new_bytes > static_cast< std::size_t >(this->_limit - start)) {
+                    return false;
+                }
+                this->_cursor = start + new_bytes;
+                return true;
+            }
+
+            /**
+             * @brief Invalide toutes les allocations. Seul le dernier bloc,
+             * le plus grand, est conservé et le curseur revient à son début :
+             * le coût ne dépend pas du nombre d'allocations, seulement du
+             * nombre de blocs, qui croît de façon logarithmique.
+             */
+            void release() {
+                if (!this->_blocks) {
+                    return;
+                }
+                this->_free_blocks(this->_blocks);
+                this->_blocks->next = u_nullptr;
+                this->_cursor = reinterpret_cast< char* >(this->_blocks) + HEADER_SIZE;
+            }
+
+            /**
+             * @brief Nombre d'octets encore disponibles dans le bloc courant
+             * pour une allocation alignée sur align, 0 si le remplissage
+             * d'alignement dépasse déjà la fin du bloc.
+             */
+            std::size_t remaining(std::size_t align = 1) const {
+                char* p = this->_align(this->_cursor, align);
+                if (!this->_cursor || p > this->_limit) {
+                    return 0;
+                }
+                return static_cast< std::size_t >(this->_limit - p);
+            }
+
+        private:
+            arena(const arena&);
+            arena& operator=(const arena&);
+
+            static char* _align(char* p, std::size_t align) {
+                std::size_t address = reinterpret_cast< std::size_t >(p);
+                return p + ((align - address % align) % align);
+            }
+
+            void _grow(std::size_t min_bytes) {
+                std::size_t size = this->_next_size;
+                while (size < min_bytes) {
+                    size *= 2;
+                }
+                char* raw = static_cast< char* >(::operator new(HEADER_SIZE + size));
+                block* header = reinterpret_cast< block* >(raw);
+                header->next = this->_blocks;
+                header->size = size;
+                this->_blocks = header;
+                this->_cursor = raw + HEADER_SIZE;
+                this->_limit = this->_cursor + size;
+                this->_next_size = size * 2;
+            }
+
+            /**
+             * @brief Rend à operator delete tous les blocs sauf keep.
+             */
+            void _free_blocks(block* keep) {
+                block* current = this->_blocks;
+                while (current) {
+                    block* next = current->next;
+                    if (current != keep) {
+                        ::operator delete(current);
+                    }
+                    current = next;
+                }
+                if (!keep) {
+                    this->_blocks = u_nullptr;
+                    this->_cursor = u_nullptr;
+                    this->_limit = u_nullptr;
+                }
+            }
+    };
+
+    /**
+     * @brief Adaptateur qui fait d'une ft::arena l'allocateur d'un conteneur.
+     * Copier l'allocateur partage l'arène, qui doit survivre au conteneur.
+     * Avec ft::vector, une croissance dont le stockage est la dernière
+     * allocation de l'arène se fait en place, sans copie.
+     *
+     * @tparam T Type des éléments alloués.
+     */
+    template < class T >
+    class arena_allocator {
+        public:
+            typedef T value_type;
+            typedef T* pointer;
+            typedef const T* const_pointer;
+            typedef T& reference;
+            typedef const T& const_reference;
+            typedef std::size_t size_type;
+            typedef std::ptrdiff_t difference_type;
+
+            template < class U >
+            struct rebind {
+                typedef arena_allocator< U > other;
+            };
+
+        private:
+            template < class U >
+            friend class arena_allocator;
+
+            arena* _arena;
+
+        public:
+            explicit arena_allocator(arena& source) : _arena(&source) {}
+
+            arena_allocator(const arena_allocator& other) : _arena(other._arena) {}
+
+            template < class U >
+            arena_allocator(const arena_allocator< U >& other) : _arena(other._arena) {}
+
+            ~arena_allocator() {}
+
+            arena_allocator& operator=(const arena_allocator& other) {
+                this->_arena = other._arena;
+                return *this;
+            }
+
+            pointer address(reference x) const { return &x; }
+
+            const_pointer address(const_reference x) const { return &x; }
+
+            pointer allocate(size_type n, const void* = 0) {
+                if (n > this->max_size()) {
+                    throw std::bad_alloc();
+                }
+                return static_cast< pointer >(
+                    this->_arena->allocate(n * sizeof(T), ft::alignment_of< T >::value));
+            }
+
+            void deallocate(pointer, size_type) {}
+
+            bool try_extend(pointer p, size_type old_n, size_type new_n) {
+                if (new_n > this->max_size()) {
+                    return false;
+                }
+                return this->_arena->try_extend(p, old_n * sizeof(T), new_n * sizeof(T));
+            }
+
+            size_type max_size() const {
+                return std::numeric_limits< size_type >::max() / sizeof(T);
+            }
+
+#ifdef FT_CONTAINERS_CXX11
+            template < class U, class... Args >
+            void construct(U* p, Args&&... args) {
+                ::new (static_cast< void* >(p)) U(std::forward< Args >(args)...);
+            }
+
+            template < class U >
+            void destroy(U* p) {
+                p->~U();
+            }
+#else
+            void construct(pointer p, const_reference val) { new (p) T(val); }
+
+            void destroy(pointer p) { p->~T(); }
+#endif
+
+            arena* resource() const { return this->_arena; }
+    };
+
+    template < class T, class U >
+    bool operator==(const arena_allocator< T >& lhs, const arena_allocator< U >& rhs) {
+        return lhs.resource() == rhs.resource();
+    }
+
+    template < class T, class U >
+    bool operator!=(const arena_allocator< T >& lhs, const arena_allocator< U >& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template < class T >
+    struct allocator_expansion< arena_allocator< T > >
+        : public allocator_expansion_base< arena_allocator< T > > {
+        typedef typename arena_allocator< T >::pointer pointer;
+        typedef typename arena_allocator< T >::size_type size_type;
+
+        static bool try_expand(arena_allocator< T >& alloc, pointer p, size_type old_n,
+                            size_type new_n) {
+            return alloc.try_extend(p, old_n, new_n);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_test.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "arena.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <string>
+#ifdef FT_CONTAINERS_CXX11
+#include <memory>
+#endif
+
+#include "vector.hpp"
+
+void test_arena(void) {
+    std::cout << "Test: arena" << std::endl;
+
+    ft::arena bump(256);
+    char* a = static_cast< char* >(bump.allocate(10, 1));
+    char* b = static_cast< char* >(bump.allocate(8, 8));
+    assert(b >= a + 10 && b < a + 24);
+    assert(reinterpret_cast< std::size_t >(b) % 8 == 0);
+    bump.deallocate(a, 10);
+    char* c = static_cast< char* >(bump.allocate(4, 1));
+    assert(c == b + 8);
+
+    assert(bump.try_extend(c, 4, 100) && !bump.try_extend(b, 8, 16));
+    char* big = static_cast< char* >(bump.allocate(1000, 16));
+    assert(reinterpret_cast< std::size_t >(big) % 16 == 0);
+    bump.release();
+    assert(bump.remaining() >= 1000);
+
+    /* Le remplissage d'alignement seul dépasse la fin du bloc : nouveau bloc */
+    ft::arena tight(100);
+    char* nearly_full = static_cast< char* >(tight.allocate(98, 1));
+    assert(tight.remaining() == 2 && tight.remaining(8) == 0);
+    char* aligned = static_cast< char* >(tight.allocate(8, 8));
+    assert(aligned < nearly_full || aligned >= nearly_full + 100);
+    assert(reinterpret_cast< std::size_t >(aligned) % 8 == 0);
+
+    ft::arena shared;
+    ft::arena_allocator< int > alloc(shared);
+    ft::vector< int, ft::arena_allocator< int > > ints(alloc);
+    ints.push_back(0);
+    const int* first = &ints[0];
+    for (int i = 1; i < 500; ++i) {
+        ints.push_back(i);
+    }
+    assert(&ints[0] == first && ints.size() == 500 && ints[499] == 499);
+
+    ft::vector< int, ft::arena_allocator< int > > other(alloc);
+    other.push_back(1);
+    ints.reserve(1000);
+    assert(&ints[0] != first && ints[499] == 499);
+
+    /* swap échange aussi les allocateurs : chaque vecteur grandit dans l'arène
+       qui possède sa mémoire */
+    {
+        ft::arena first_arena;
+        ft::arena second_arena;
+        ft::arena_allocator< int > first_alloc(first_arena);
+        ft::arena_allocator< int > second_alloc(second_arena);
+        ft::vector< int, ft::arena_allocator< int > > from_first(10, 1, first_alloc);
+        ft::vector< int, ft::arena_allocator< int > > from_second(20, 2, second_alloc);
+        from_first.swap(from_second);
+        assert(from_first.get_allocator() == second_alloc && from_first.size() == 20);
+        assert(from_second.get_allocator() == first_alloc && from_second.size() == 10);
+        ft::swap(from_first, from_second);
+        assert(from_first.get_allocator() == first_alloc && from_first[9] == 1);
+        from_first.swap(from_second);
+        from_first.resize(500, 3);
+        from_second.resize(500, 4);
+        assert(from_first.get_allocator().resource() == &second_arena);
+        assert(from_second.get_allocator().resource() == &first_arena);
+        assert(from_first[19] == 2 && from_first[499] == 3 && from_second[9] == 1);
+    }
+
+    ft::arena_allocator< std::string > strings_alloc(alloc);
+    assert(strings_alloc == alloc);
+    ft::vector< std::string, ft::arena_allocator< std::string > > strings(strings_alloc);
+    for (int i = 0; i < 100; ++i) {
+        strings.insert(strings.begin(), std::string(30, 'a'));
+    }
+    assert(strings.size() == 100 && strings[99].size() == 30);
+
+#ifdef FT_CONTAINERS_CXX11
+    /* construct transmet ses arguments : les éléments non copiables passent */
+    typedef ft::arena_allocator< std::unique_ptr< int > > owner_allocator;
+    owner_allocator owner_alloc(alloc);
+    ft::vector< std::unique_ptr< int >, owner_allocator > owners(owner_alloc);
+    for (int i = 0; i < 300; ++i) {
+        owners.emplace_back(new int(i));
+    }
+    owners.insert(owners.begin() + 1, std::unique_ptr< int >(new int(-1)));
+    assert(owners.size() == 301 && *owners[1] == -1 && *owners[300] == 299);
+#endif
+}
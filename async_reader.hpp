@@ -0,0 +1,374 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   async_reader.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _ASYNC_READER_HPP_
+#define _ASYNC_READER_HPP_
+
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Lecture d'un descripteur de fichier par blocs, en double tampon :
+     * un thread d'arrière-plan remplit un tampon avec read (ou pread à partir
+     * d'une position donnée) pendant que l'appelant traite l'autre.
+     *
+     * next() remet à l'appelant un bloc qui pointe directement dans le tampon
+     * rempli, sans copie ; le bloc reste valide jusqu'à l'appel suivant de
+     * next(), qui rend son tampon au thread de lecture. Chaque bloc fait
+     * chunk_size octets, sauf le dernier. Le descripteur n'est ni fermé ni
+     * possédé par le lecteur ; il ne doit pas être lu par ailleurs tant que
+     * le lecteur existe.
+     */
+    class async_fd_reader {
+        public:
+            static const std::size_t DEFAULT_CHUNK_SIZE = std::size_t(1) << 20;
+            static const off_t CURRENT_POSITION = -1;
+
+            struct chunk {
+                const char* data;
+                std::size_t size;
+            };
+
+        private:
+            struct buffer {
+                char* data;
+                std::size_t size;
+                int error;
+                bool full;
+                bool last;
+            };
+
+            int _fd;
+            off_t _offset;
+            std::size_t _chunk_size;
+            buffer _buffers[2];
+            /* Tampon détenu par l'appelant (-1 : aucun), prochain à remettre */
+            int _held;
+            int _next;
+            bool _stopping;
+            bool _finished;
+            pthread_mutex_t _mutex;
+            pthread_cond_t _filled;
+            pthread_cond_t _released;
+            pthread_t _thread;
+
+            async_fd_reader(const async_fd_reader&);
+            async_fd_reader& operator=(const async_fd_reader&);
+
+        public:
+            /**
+             * @brief Démarre la lecture de fd. Avec offset == CURRENT_POSITION,
+             * le fichier est lu par read depuis sa position courante (tube,
+             * socket...) ; sinon par pread à partir de offset.
+             */
+            explicit async_fd_reader(int fd, std::size_t chunk_size = DEFAULT_CHUNK_SIZE,
+                                    off_t offset = CURRENT_POSITION)
+                : _fd(fd),
+                    _offset(offset),
+                    _chunk_size(chunk_size ? chunk_size : 1),
+                    _held(-1),
+                    _next(0),
+                    _stopping(false),
+                    _finished(false) {
+                for (int i = 0; i < 2; ++i) {
+                    this->_buffers[i].size = 0;
+                    this->_buffers[i].error = 0;
+                    this->_buffers[i].full = false;
+                    this->_buffers[i].last = false;
+                    this->_buffers[i].data = static_cast< char* >(std::malloc(this->_chunk_size));
+                }
+                if (!this->_buffers[0].data || !this->_buffers[1].data) {
+                    std::free(this->_buffers[0].data);
+                    std::free(this->_buffers[1].data);
+                    throw std::bad_alloc();
+                }
+                pthread_mutex_init(&this->_mutex, u_nullptr);
+                pthread_cond_init(&this->_filled, u_nullptr);
+                pthread_cond_init(&this->_released, u_nullptr);
+                int error = pthread_create(&this->_thread, u_nullptr, &async_fd_reader::_run, this);
+                if (error != 0) {
+                    this->_destroy();
+                    throw std::runtime_error(std::string("ft::async_fd_reader: pthread_create: ") +
+                                            std::strerror(error));
+                }
+            }
+
+            /**
+             * @brief Arrête le thread de lecture, au plus tard après le bloc en
+             * cours, et libère les tampons.
+             */
+            ~async_fd_reader() {
+                pthread_mutex_lock(&this->_mutex);
+                this->_stopping = true;
+                pthread_cond_signal(&this->_released);
+                pthread_mutex_unlock(&this->_mutex);
+                pthread_join(this->_thread, u_nullptr);
+                this->_destroy();
+            }
+
+            /**
+             * @brief Rend le bloc précédent et attend le suivant. Renvoie false
+             * une fois le fichier entièrement lu. Lève std::runtime_error si
+             * la lecture a échoué.
+             */
+            bool next(chunk& out) {
+                pthread_mutex_lock(&this->_mutex);
+                if (this->_held >= 0) {
+                    this->_buffers[this->_held].full = false;
+                    this->_held = -1;
+                    pthread_cond_signal(&this->_released);
+                }
+                if (this->_finished) {
+                    pthread_mutex_unlock(&this->_mutex);
+                    return false;
+                }
+                buffer& current = this->_buffers[this->_next];
+                while (!current.full) {
+                    pthread_cond_wait(&this->_filled, &this->_mutex);
+                }
+                this->_finished = current.last;
+                if (current.error != 0) {
+                    int error = current.error;
+                    current.full = false;
+                    pthread_mutex_unlock(&this->_mutex);
+                    throw std::runtime_error(std::string("ft::async_fd_reader: read: ") +
+                                            std::strerror(error));
+                }
+                this->_held = this->_next;
+                this->_next ^= 1;
+                pthread_mutex_unlock(&this->_mutex);
+                if (current.size == 0) {
+                    return this->next(out);
+                }
+                out.data = current.data;
+                out.size = current.size;
+                return true;
+            }
+
+            std::size_t chunk_size() const { return this->_chunk_size; }
+
+        private:
+            static void* _run(void* self) {
+                static_cast< async_fd_reader* >(self)->_produce();
+                return u_nullptr;
+            }
+
+            /**
+             * @brief Boucle du thread de lecture : attend qu'un tampon soit
+             * libre, le remplit hors verrou, puis le publie.
+             */
+            void _produce() {
+                for (int index = 0;; index ^= 1) {
+                    buffer& target = this->_buffers[index];
+                    pthread_mutex_lock(&this->_mutex);
+                    while (target.full && !this->_stopping) {
+                        pthread_cond_wait(&this->_released, &this->_mutex);
+                    }
+                    bool stopping = this->_stopping;
+                    pthread_mutex_unlock(&this->_mutex);
+                    if (stopping) {
+                        return;
+                    }
+
+                    std::size_t size = 0;
+                    int error = 0;
+                    bool last = this->_fill(target.data, size, error);
+
+                    pthread_mutex_lock(&this->_mutex);
+                    target.size = size;
+                    target.error = error;
+                    target.last = last;
+                    target.full = true;
+                    pthread_cond_signal(&this->_filled);
+                    pthread_mutex_unlock(&this->_mutex);
+                    if (last) {
+                        return;
+                    }
+                }
+            }
+
+            /**
+             * @brief Remplit data jusqu'à chunk_size octets, en reprenant les
+             * lectures partielles. Renvoie true si la fin du fichier ou une
+             * erreur a été atteinte.
+             */
+            bool _fill(char* data, std::size_t& size, int& error) {
+                while (size < this->_chunk_size) {
+                    ssize_t n;
+                    if (this->_offset == CURRENT_POSITION) {
+                        n = ::read(this->_fd, data + size, this->_chunk_size - size);
+                    } else {
+                        n = ::pread(this->_fd, data + size, this->_chunk_size - size,
+                                    this->_offset);
+                    }
+                    if (n < 0) {
+                        if (errno == EINTR) {
+                            continue;
+                        }
+                        error = errno;
+                        return true;
+                    }
+                    if (n == 0) {
+                        return true;
+                    }
+                    size += static_cast< std::size_t >(n);
+                    if (this->_offset != CURRENT_POSITION) {
+                        this->_offset += n;
+                    }
+                }
+                return false;
+            }
+
+            void _destroy() {
+                pthread_cond_destroy(&this->_released);
+                pthread_cond_destroy(&this->_filled);
+                pthread_mutex_destroy(&this->_mutex);
+                std::free(this->_buffers[0].data);
+                std::free(this->_buffers[1].data);
+            }
+    };
+
+    /**
+     * @brief Itérateur d'entrée sur les enregistrements binaires de type T
+     * lus par un ft::async_fd_reader. Chaque enregistrement est copié du bloc
+     * courant (éventuellement à cheval sur deux blocs) vers l'itérateur ; les
+     * blocs eux-mêmes ne sont jamais recopiés. Le parcours est à passe
+     * unique : ft::vector l'insère au fil de la lecture. L'itérateur construit
+     * par défaut marque la fin.
+     *
+     * @tparam T Type trivialement copiable des enregistrements.
+     */
+    template < class T >
+    class fd_record_iterator {
+        private:
+            typedef char record_must_be_trivially_copyable
+                [ft::is_trivially_copyable< T >::value ? 1 : -1];
+
+        public:
+            typedef ft::input_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T* pointer;
+            typedef const T& reference;
+
+        private:
+            async_fd_reader* _reader;
+            const char* _position;
+            const char* _end;
+            T _value;
+
+        public:
+            fd_record_iterator() : _reader(u_nullptr), _position(u_nullptr), _end(u_nullptr) {}
+
+            explicit fd_record_iterator(async_fd_reader& reader)
+                : _reader(&reader), _position(u_nullptr), _end(u_nullptr) {
+                this->_read();
+            }
+
+            reference operator*() const { return this->_value; }
+
+            pointer operator->() const { return &this->_value; }
+
+            fd_record_iterator& operator++() {
+                this->_read();
+                return *this;
+            }
+
+            fd_record_iterator operator++(int) {
+                fd_record_iterator tmp(*this);
+                this->_read();
+                return tmp;
+            }
+
+            friend bool operator==(const fd_record_iterator& lhs, const fd_record_iterator& rhs) {
+                return lhs._reader == rhs._reader;
+            }
+
+            friend bool operator!=(const fd_record_iterator& lhs, const fd_record_iterator& rhs) {
+                return lhs._reader != rhs._reader;
+            }
+
+        private:
+            /**
+             * @brief Copie l'enregistrement suivant dans _value, ou devient
+             * l'itérateur de fin si le fichier est terminé. Lève
+             * std::runtime_error si le fichier s'arrête au milieu d'un
+             * enregistrement.
+             */
+            void _read() {
+                char* out = reinterpret_cast< char* >(&this->_value);
+                std::size_t missing = sizeof(T);
+                while (missing > 0) {
+                    if (this->_position == this->_end) {
+                        async_fd_reader::chunk next;
+                        if (!this->_reader->next(next)) {
+                            if (missing != sizeof(T)) {
+                                throw std::runtime_error(
+                                    "ft::fd_record_iterator: truncated record");
+                            }
+                            this->_reader = u_nullptr;
+                            return;
+                        }
+                        this->_position = next.data;
+                        this->_end = next.data + next.size;
+                    }
+                    std::size_t n = static_cast< std::size_t >(this->_end - this->_position);
+                    if (n > missing) {
+                        n = missing;
+                    }
+                    std::memcpy(out, this->_position, n);
+                    out += n;
+                    this->_position += n;
+                    missing -= n;
+                }
+            }
+    };
+
+    /**
+     * @brief Ajoute à la fin de v les enregistrements binaires de type T lus
+     * sur fd jusqu'à la fin du fichier, la lecture du bloc suivant se faisant
+     * en parallèle de l'insertion du bloc courant. Pour un fichier régulier,
+     * la capacité est réservée d'après sa taille restante ; le fichier n'est
+     * jamais chargé en entier avant l'insertion.
+     */
+    template < class T, class Alloc >
+    void append_records(int fd, ft::vector< T, Alloc >& v,
+                        std::size_t chunk_size = async_fd_reader::DEFAULT_CHUNK_SIZE) {
+        struct stat st;
+        off_t position = lseek(fd, 0, SEEK_CUR);
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && position >= 0 &&
+            st.st_size > position) {
+            v.reserve(v.size() + static_cast< std::size_t >(st.st_size - position) / sizeof(T));
+        }
+        async_fd_reader reader(fd, chunk_size);
+        v.insert(v.end(), fd_record_iterator< T >(reader), fd_record_iterator< T >());
+    }
+}
+
+#endif
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   async_reader_bench.cpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "async_reader.hpp"
+#include "vector.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "bench.hpp"
+
+namespace {
+    const std::size_t ELEMENT_COUNT = std::size_t(1) << 24;
+
+    /**
+     * @brief Ouvre le fichier après en avoir retiré les pages du cache, pour
+     * que chaque chargement lise vraiment le disque (si le système le permet).
+     */
+    int open_uncached(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        fdatasync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        return fd;
+    }
+
+    /**
+     * @brief Chargement actuel : le fichier entier est lu dans un tampon,
+     * puis inséré dans le vecteur.
+     */
+    void load_whole_file(int fd, ft::vector< unsigned long >& v) {
+        ft::vector< char > file;
+        char block[1 << 16];
+        ssize_t n;
+        while ((n = read(fd, block, sizeof(block))) > 0) {
+            file.insert(file.end(), block, block + n);
+        }
+        const unsigned long* first = reinterpret_cast< const unsigned long* >(&file[0]);
+        v.insert(v.end(), first, first + file.size() / sizeof(unsigned long));
+    }
+
+    template < class Load >
+    void run(const char* name, const std::string& path, Load load) {
+        int fd = open_uncached(path);
+        bool peak_reset = bench::reset_peak_rss();
+        double base_mib = bench::status_mib("VmRSS");
+        double start = bench::now_ns();
+        unsigned long sum = 0;
+        {
+            ft::vector< unsigned long > v;
+            load(fd, v);
+            for (std::size_t i = 0; i < v.size(); i += 4096) {
+                sum += v[i];
+            }
+            std::cout << "\t " << name << ": " << (bench::now_ns() - start) / 1e6
+                    << " ms, peak RSS +" << bench::status_mib("VmHWM") - base_mib << " MiB"
+                    << (peak_reset ? "" : " (process peak)") << " for "
+                    << v.size() * sizeof(unsigned long) / (1024.0 * 1024.0) << " MiB of data"
+                    << std::endl;
+        }
+        close(fd);
+        if (sum == 1) {
+            std::cout << std::endl;
+        }
+    }
+
+    void append(int fd, ft::vector< unsigned long >& v) {
+        ft::append_records(fd, v);
+    }
+}
+
+/**
+ * @brief Chargement de ELEMENT_COUNT entiers de 8 octets depuis un fichier :
+ * lecture complète puis insertion, face à ft::append_records qui insère un
+ * bloc pendant que le thread de lecture remplit le suivant.
+ */
+void bench_async_reader(void) {
+    std::ostringstream path;
+    path << "/tmp/ft_async_reader_bench_" << getpid();
+    {
+        ft::vector< unsigned long > data;
+        bench::lcg rng(42);
+        for (std::size_t i = 0; i < ELEMENT_COUNT; ++i) {
+            data.push_back(rng.next(ELEMENT_COUNT));
+        }
+        int fd = open(path.str().c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        std::size_t size = data.size() * sizeof(unsigned long);
+        const char* bytes = reinterpret_cast< const char* >(&data[0]);
+        for (std::size_t done = 0; done < size;) {
+            ssize_t n = write(fd, bytes + done, size - done);
+            if (n <= 0) {
+                break;
+            }
+            done += static_cast< std::size_t >(n);
+        }
+        close(fd);
+    }
+
+    std::cout << "Bench: async_reader, " << ELEMENT_COUNT << " unsigned long" << std::endl;
+    run("read whole file, then insert", path.str(), load_whole_file);
+    run("ft::append_records", path.str(), append);
+    std::remove(path.str().c_str());
+}
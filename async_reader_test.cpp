@@ -0,0 +1,201 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   async_reader_test.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "algorithm.hpp"
+#include "async_reader.hpp"
+#include "vector.hpp"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    struct record {
+        int id;
+        double value;
+    };
+
+    std::string temporary_path(const char* name) {
+        std::ostringstream path;
+        path << "/tmp/ft_async_reader_" << name << "_" << getpid();
+        return path.str();
+    }
+
+    void write_file(const std::string& path, const void* data, std::size_t size) {
+        int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        assert(fd >= 0);
+        assert(write(fd, data, size) == static_cast< ssize_t >(size));
+        close(fd);
+    }
+
+    struct pipe_writer {
+        int fd;
+        const ft::vector< record >* records;
+    };
+
+    /**
+     * @brief Écrit les enregistrements dans le tube par petits morceaux, pour
+     * que le lecteur reçoive des lectures partielles.
+     */
+    void* write_records(void* arg) {
+        pipe_writer* writer = static_cast< pipe_writer* >(arg);
+        const char* bytes = reinterpret_cast< const char* >(&(*writer->records)[0]);
+        std::size_t size = writer->records->size() * sizeof(record);
+        for (std::size_t done = 0; done < size;) {
+            std::size_t n = size - done < 777 ? size - done : 777;
+            ssize_t written = write(writer->fd, bytes + done, n);
+            assert(written > 0);
+            done += static_cast< std::size_t >(written);
+        }
+        close(writer->fd);
+        return ft::u_nullptr;
+    }
+}
+
+void test_async_reader(void) {
+    std::cout << "Test: async_reader" << std::endl;
+
+    std::string path = temporary_path("ints");
+    ft::vector< int > ints;
+    for (int i = 0; i < 300000; ++i) {
+        ints.push_back(i * 3 - 11);
+    }
+    write_file(path, &ints[0], ints.size() * sizeof(int));
+
+    /* Blocs : remis sans copie, de taille chunk_size sauf le dernier */
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        ft::async_fd_reader reader(fd, 4096);
+        ft::async_fd_reader::chunk chunk;
+        const char* expected = reinterpret_cast< const char* >(&ints[0]);
+        std::size_t total = 0;
+        std::size_t chunks = 0;
+        while (reader.next(chunk)) {
+            assert(chunk.size == 4096 || total + chunk.size == ints.size() * sizeof(int));
+            assert(std::memcmp(chunk.data, expected + total, chunk.size) == 0);
+            total += chunk.size;
+            ++chunks;
+        }
+        assert(total == ints.size() * sizeof(int) && chunks == (total + 4095) / 4096);
+        assert(!reader.next(chunk));
+        close(fd);
+    }
+
+    /* pread depuis une position, sans toucher à celle du descripteur */
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        ft::async_fd_reader reader(fd, 1000, 400 * sizeof(int));
+        ft::vector< int > tail((ft::fd_record_iterator< int >(reader)),
+                            ft::fd_record_iterator< int >());
+        assert(tail.size() == ints.size() - 400);
+        assert(ft::equal(tail.begin(), tail.end(), ints.begin() + 400));
+        assert(lseek(fd, 0, SEEK_CUR) == 0);
+        close(fd);
+    }
+
+    /* Enregistrements à cheval sur deux blocs, ajoutés après l'existant */
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        ft::vector< int > v(5, 42);
+        ft::append_records(fd, v, 1001);
+        assert(v.size() == ints.size() + 5 && v[4] == 42 && v[5] == -11);
+        assert(ft::equal(v.begin() + 5, v.end(), ints.begin()));
+        close(fd);
+    }
+
+    /* Insertion au milieu depuis l'itérateur à passe unique */
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        ft::vector< int > v(10, 7);
+        ft::async_fd_reader reader(fd, 333);
+        v.insert(v.begin() + 3, ft::fd_record_iterator< int >(reader),
+                ft::fd_record_iterator< int >());
+        assert(v.size() == ints.size() + 10 && v[2] == 7 && v[3] == -11);
+        assert(v[ints.size() + 2] == ints.back() && v[ints.size() + 3] == 7);
+        close(fd);
+    }
+
+    /* Tube alimenté par un autre thread : lectures partielles avec read */
+    {
+        ft::vector< record > records;
+        for (int i = 0; i < 20000; ++i) {
+            record r = {i, i * 0.25};
+            records.push_back(r);
+        }
+        int fds[2];
+        assert(pipe(fds) == 0);
+        pipe_writer writer = {fds[1], &records};
+        pthread_t thread;
+        assert(pthread_create(&thread, ft::u_nullptr, write_records, &writer) == 0);
+        ft::vector< record > received;
+        ft::append_records(fds[0], received, 4096);
+        pthread_join(thread, ft::u_nullptr);
+        close(fds[0]);
+        assert(received.size() == records.size());
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            assert(received[i].id == records[i].id && received[i].value == records[i].value);
+        }
+    }
+
+    /* Fichier vide, fichier tronqué, descripteur illisible */
+    {
+        write_file(path, "", 0);
+        int fd = open(path.c_str(), O_RDONLY);
+        ft::vector< int > v;
+        ft::append_records(fd, v);
+        assert(v.empty());
+        close(fd);
+
+        write_file(path, &ints[0], 10 * sizeof(int) + 2);
+        fd = open(path.c_str(), O_RDONLY);
+        bool thrown = false;
+        try {
+            ft::append_records(fd, v, 16);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && v.size() == 10);
+        close(fd);
+
+        fd = open(path.c_str(), O_WRONLY);
+        thrown = false;
+        try {
+            ft::append_records(fd, v);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        close(fd);
+    }
+
+    /* Abandon avant la fin : le thread de lecture s'arrête */
+    {
+        write_file(path, &ints[0], ints.size() * sizeof(int));
+        int fd = open(path.c_str(), O_RDONLY);
+        {
+            ft::async_fd_reader reader(fd, 64);
+            ft::async_fd_reader::chunk chunk;
+            assert(reader.next(chunk) && chunk.size == 64);
+        }
+        close(fd);
+    }
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,200 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _BENCH_HPP_
+#define _BENCH_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+    /**
+     * @brief Renvoie le temps monotone courant en nanosecondes.
+     */
+    inline double now_ns(void) {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec * 1e9 + ts.tv_nsec;
+    }
+
+    /**
+     * @brief Remet à zéro le pic de mémoire résidente du processus
+     * (Linux : écrire 5 dans /proc/self/clear_refs). Renvoie false si ce
+     * n'est pas possible, le pic mesuré est alors celui du processus.
+     */
+    inline bool reset_peak_rss(void) {
+        std::FILE* file = std::fopen("/proc/self/clear_refs", "w");
+        if (!file) {
+            return false;
+        }
+        bool done = std::fputs("5", file) >= 0;
+        return std::fclose(file) == 0 && done;
+    }
+
+    /**
+     * @brief Valeur en Mio d'une ligne de /proc/self/status (VmRSS, VmHWM).
+     */
+    inline double status_mib(const char* field) {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        std::size_t length = std::strlen(field);
+        while (std::getline(status, line)) {
+            if (line.compare(0, length, field) == 0 && line.size() > length &&
+                line[length] == ':') {
+                return std::strtod(line.c_str() + length + 1, NULL) / 1024.0;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Générateur congruentiel déterministe, pour que ft:: et std::
+     * reçoivent exactement la même suite d'opérations.
+     */
+    struct lcg {
+        unsigned long state;
+
+        explicit lcg(unsigned long seed) : state(seed) {}
+
+        std::size_t next(std::size_t bound) {
+            this->state = this->state * 6364136223846793005UL + 1442695040888963407UL;
+            return static_cast< std::size_t >(this->state >> 33) % bound;
+        }
+    };
+
+    /**
+     * @brief Distribution des temps par opération d'un cas mesuré, en ns.
+     */
+    struct summary {
+        double median_ns;
+        double p99_ns;
+        double min_ns;
+    };
+
+    /**
+     * @brief Mesure un cas : warmup tours non retenus, puis reps tours.
+     * Chaque tour appelle op.setup() hors chronométrage, puis chronomètre
+     * op.run(), qui enchaîne op.batch() opérations pour que la durée d'un
+     * tour dépasse largement la résolution de l'horloge.
+     */
+    template < class Op >
+    summary measure(Op& op, std::size_t warmup = 3, std::size_t reps = 31) {
+        std::vector< double > samples;
+        samples.reserve(reps);
+        for (std::size_t i = 0; i < warmup + reps; ++i) {
+            op.setup();
+            double start = now_ns();
+            op.run();
+            double elapsed = now_ns() - start;
+            if (i >= warmup) {
+                samples.push_back(elapsed / op.batch());
+            }
+        }
+        std::sort(samples.begin(), samples.end());
+        std::size_t n = samples.size();
+        std::size_t p99 = (n * 99 + 99) / 100;
+        summary s;
+        s.median_ns = samples[n / 2];
+        s.p99_ns = samples[(p99 < n ? p99 : n) - 1];
+        s.min_ns = samples[0];
+        return s;
+    }
+
+    /**
+     * @brief Écrit les résultats en CSV, une ligne par cas mesuré.
+     */
+    struct csv_writer {
+        std::ostream& out;
+
+        explicit csv_writer(std::ostream& stream) : out(stream) {}
+
+        void header() { this->out << "suite,case,library,type,size,median_ns,p99_ns,min_ns\n"; }
+
+        void row(const char* suite, const char* name, const char* library, const char* type,
+                std::size_t size, const summary& s) {
+            this->out << suite << ',' << name << ',' << library << ',' << type << ',' << size
+                    << ',' << s.median_ns << ',' << s.p99_ns << ',' << s.min_ns << '\n';
+        }
+    };
+
+    /**
+     * @brief Compteurs partagés par toutes les instances de counting_allocator.
+     */
+    struct alloc_stats {
+        static std::size_t allocations;
+        static std::size_t deallocations;
+
+        static void reset(void) {
+            allocations = 0;
+            deallocations = 0;
+        }
+    };
+
+    /**
+     * @brief Allocateur qui compte les appels à allocate et deallocate
+     * avant de déléguer à std::allocator.
+     *
+     * @tparam T Type des éléments alloués.
+     */
+    template < class T >
+    struct counting_allocator : public std::allocator< T > {
+        typedef typename std::allocator< T >::pointer pointer;
+        typedef typename std::allocator< T >::size_type size_type;
+
+        template < class U >
+        struct rebind {
+            typedef counting_allocator< U > other;
+        };
+
+        counting_allocator() {}
+        counting_allocator(const counting_allocator& other)
+            : std::allocator< T >(other) {}
+        template < class U >
+        counting_allocator(const counting_allocator< U >&) {}
+
+        pointer allocate(size_type n, const void* = 0) {
+            ++alloc_stats::allocations;
+            return std::allocator< T >::allocate(n);
+        }
+
+        void deallocate(pointer p, size_type n) {
+            ++alloc_stats::deallocations;
+            std::allocator< T >::deallocate(p, n);
+        }
+    };
+}
+
+void bench_vector(void);
+void bench_algorithm(void);
+void bench_small_vector(void);
+void bench_pool_allocator(void);
+void bench_map(void);
+void bench_btree_map(void);
+void bench_unordered_flat_map(void);
+void bench_huge_page_allocator(void);
+void bench_mapped_vector(void);
+void bench_snapshot(void);
+void bench_async_reader(void);
+void bench_parallel(void);
+void bench_vector_ops(std::ostream& out);
+
+#endif
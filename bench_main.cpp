@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_main.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <fstream>
+#include <iostream>
+
+#include "bench.hpp"
+
+std::size_t bench::alloc_stats::allocations = 0;
+std::size_t bench::alloc_stats::deallocations = 0;
+
+/**
+ * @brief Lance tous les bancs d'essai. Les résultats CSV des opérations de
+ * vector sont écrits dans le fichier passé en argument, sinon sur la
+ * sortie standard.
+ */
+int main(int argc, char** argv) {
+    std::cout << "Bench: ft_containers" << std::endl;
+
+    std::ofstream csv_file;
+    if (argc > 1) {
+        csv_file.open(argv[1]);
+        if (!csv_file) {
+            std::cerr << "container_bench: cannot open " << argv[1] << std::endl;
+            return 1;
+        }
+    }
+    bench_vector_ops(argc > 1 ? csv_file : std::cout);
+
+    bench_vector();
+    bench_algorithm();
+    bench_small_vector();
+    bench_pool_allocator();
+    bench_map();
+    bench_btree_map();
+    bench_unordered_flat_map();
+    bench_huge_page_allocator();
+    bench_mapped_vector();
+    bench_snapshot();
+    bench_async_reader();
+    bench_parallel();
+
+    return 0;
+}
@@ -14,10 +14,18 @@
 #define _BIDIRECTIONAL_ITERATOR_HPP_
 
 #include "iterator.hpp"
+#include "rb_tree.hpp"
+#include "type_traits.hpp"
 #include "util.hpp"
 
 namespace ft {
 
+    /**
+     * @brief Itérateur bidirectionnel sur les noeuds d'un arbre rouge-noir :
+     * ++ et -- suivent l'ordre infixe, end() étant le header de l'arbre.
+     *
+     * @tparam T Type de valeur des noeuds, éventuellement const.
+     */
     template < class T >
     class bidirectional_iterator
         : public ft::iterator< ft::bidirectional_iterator_tag, T > {
@@ -42,38 +50,45 @@ namespace ft {
             typedef typename ft::iterator< ft::bidirectional_iterator_tag, T >::reference
                 reference;
 
+            /* Noeud portant la valeur, sans qualificatif const */
+            typedef rb_node< typename ft::remove_cv< T >::type > node_type;
+
         protected:
-            pointer ptr;
+            rb_node_base* _node;
 
         public:
             /**
              * @brief constructeur par défaut
              */
-            bidirectional_iterator(pointer ptr = ft::u_nullptr) : ptr(ptr){};
+            bidirectional_iterator(rb_node_base* node = ft::u_nullptr) : _node(node){};
 
             /**
              * @brief copy / type-cast constructeur
              */
             bidirectional_iterator(const bidirectional_iterator& other)
-                : ptr(other.ptr){};
-
-            template < typename diffT >
-            bidirectional_iterator(const bidirectional_iterator< diffT >& other)
-                : ptr(other.base()) {}
+                : _node(other._node){};
 
             /**
-             * @brief Avance le bidirectional_iterator d'une position.
-             * @example ++ptr;
+             * @brief opérateur d'affectation
              */
-            bidirectional_iterator& operator++() {
-                ++ptr;
+            bidirectional_iterator& operator=(const bidirectional_iterator& other) {
+                this->_node = other._node;
                 return *this;
             };
 
             /**
-             * @brief Avance le bidirectional_iterator d'une position.
-             * @example ptr++;
+             * @brief bidirectional_iterator< const T > casting operator
              */
+            operator bidirectional_iterator< const T >() const { return this->_node; }
+
+            /**
+             * @brief Avance au noeud suivant dans l'ordre infixe.
+             */
+            bidirectional_iterator& operator++() {
+                this->_node = ft::rb_tree_increment(this->_node);
+                return *this;
+            };
+
             bidirectional_iterator operator++(int) {
                 bidirectional_iterator tmp = *this;
                 ++(*this);
@@ -81,52 +96,49 @@ namespace ft {
             };
 
             /**
-             * @brief Opérateurs relationnels == pour bidirectional_iterator
+             * @brief Recule au noeud précédent dans l'ordre infixe.
              */
-            bool operator==(const bidirectional_iterator< T >& other) {
-                return (this->ptr == other.ptr);
+            bidirectional_iterator& operator--() {
+                this->_node = ft::rb_tree_decrement(this->_node);
+                return *this;
             };
 
-            /**
-             * @brief Opérateurs relationnels != pour bidirectional_iterator
-             */
-            bool operator!=(const bidirectional_iterator< T >& other) {
-                return (this->ptr != other.ptr);
+            bidirectional_iterator operator--(int) {
+                bidirectional_iterator tmp = *this;
+                --(*this);
+                return tmp;
             };
 
             /**
-             * @brief Renvoie une référence pointé par l'itérateur bidirectionnel.
+             * @brief Renvoie une référence sur la valeur du noeud.
              */
-            reference operator*() const { return *ptr; };
+            reference operator*() const { return static_cast< node_type* >(this->_node)->value; };
 
             /**
-             * @brief Renvoie un pointeur sur l'adresse pointée par bidirectional_iterator
+             * @brief Renvoie un pointeur sur la valeur du noeud
              *  (afin d'accéder à l'un de ses membres).
              */
             pointer operator->() const { return &(operator*()); };
 
-            /**
-             * @brief Décrémente le bidirectional_iterator d'une position.
-             * @example --ptr;
-             */
-            bidirectional_iterator& operator--() {
-                --ptr;
-                return *this;
-            };
-
-            /**
-             * @brief Décrémente le bidirectional_iterator d'une position.
-             * @example ptr--;
-             */
-            bidirectional_iterator operator--(int) {
-                bidirectional_iterator tmp = *this;
-                --(*this);
-                return tmp;
-            };
-
-            pointer const & base() const { return ptr; }
+            rb_node_base* const& base() const { return this->_node; }
     };
 
+    /**
+     * @brief Opérateurs relationnels == et != pour bidirectional_iterator,
+     * entre itérateurs constants ou non.
+     */
+    template < class T1, class T2 >
+    bool operator==(const bidirectional_iterator< T1 >& lhs,
+                    const bidirectional_iterator< T2 >& rhs) {
+        return lhs.base() == rhs.base();
+    }
+
+    template < class T1, class T2 >
+    bool operator!=(const bidirectional_iterator< T1 >& lhs,
+                    const bidirectional_iterator< T2 >& rhs) {
+        return lhs.base() != rhs.base();
+    }
+
 }
 
 #endif
@@ -0,0 +1,225 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _BTREE_HPP_
+#define _BTREE_HPP_
+
+#include <cstddef>
+
+#include "iterator.hpp"
+#include "memory.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Nombre de clés d'un noeud de B+arbre : les clés d'un noeud
+     * occupent quatre lignes de cache de 64 octets, entre 8 et 64 clés,
+     * en nombre pair pour que les deux moitiés d'une division soient égales.
+     *
+     * @tparam Key type des clés
+     */
+    template < class Key >
+    struct btree_node_capacity {
+        static const std::size_t raw = 256 / sizeof(Key);
+        static const std::size_t value = raw < 8 ? 8 : (raw > 64 ? 64 : raw - raw % 2);
+    };
+
+    /**
+     * @brief En-tête commun à tous les noeuds d'un B+arbre.
+     * prev et next ne servent qu'aux feuilles, chaînées en une liste
+     * circulaire dont la sentinelle, une btree_node_base vide, sert de end().
+     */
+    struct btree_node_base {
+        btree_node_base* prev;
+        btree_node_base* next;
+        unsigned int count;
+        bool leaf;
+    };
+
+    /**
+     * @brief Réinitialise la sentinelle d'une liste de feuilles vide.
+     */
+    inline void btree_list_reset(btree_node_base& sentinel) {
+        sentinel.prev = &sentinel;
+        sentinel.next = &sentinel;
+        sentinel.count = 0;
+        sentinel.leaf = true;
+    }
+
+    /**
+     * @brief Insère la feuille x juste après pos dans la liste.
+     */
+    inline void btree_list_insert_after(btree_node_base* pos, btree_node_base* x) {
+        x->prev = pos;
+        x->next = pos->next;
+        pos->next->prev = x;
+        pos->next = x;
+    }
+
+    /**
+     * @brief Retire la feuille x de la liste.
+     */
+    inline void btree_list_unlink(btree_node_base* x) {
+        x->prev->next = x->next;
+        x->next->prev = x->prev;
+    }
+
+    /**
+     * @brief Noeud portant un tableau de N clés contiguës, séparé des
+     * valeurs pour que la recherche dans le noeud lise les clés d'un bloc.
+     */
+    template < class Key, std::size_t N >
+    struct btree_node : public btree_node_base {
+        ft::aligned_buffer< Key, N > keys;
+    };
+
+    /**
+     * @brief Feuille : N clés et, à la même position, les N valeurs.
+     */
+    template < class Key, class Value, std::size_t N >
+    struct btree_leaf : public btree_node< Key, N > {
+        ft::aligned_buffer< Value, N > values;
+    };
+
+    /**
+     * @brief Noeud interne : count séparateurs et count + 1 enfants, la clé
+     * i étant inférieure ou égale à toutes les clés de l'enfant i + 1 et
+     * supérieure à toutes celles de l'enfant i.
+     */
+    template < class Key, std::size_t N >
+    struct btree_inner : public btree_node< Key, N > {
+        btree_node< Key, N >* children[N + 1];
+    };
+
+    /**
+     * @brief Itérateur bidirectionnel sur les valeurs des feuilles d'un
+     * B+arbre : une feuille et une position dans cette feuille. ++ et --
+     * suivent la liste des feuilles, end() étant (sentinelle, 0).
+     *
+     * @tparam T Type de valeur des feuilles, éventuellement const.
+     * @tparam Leaf Type des feuilles.
+     */
+    template < class T, class Leaf >
+    class btree_iterator : public ft::iterator< ft::bidirectional_iterator_tag, T > {
+        public:
+            typedef typename ft::iterator< ft::bidirectional_iterator_tag,
+                                            T >::iterator_category iterator_category;
+            typedef typename ft::iterator< ft::bidirectional_iterator_tag, T >::value_type
+                value_type;
+            typedef typename ft::iterator< ft::bidirectional_iterator_tag,
+                                            T >::difference_type difference_type;
+            typedef typename ft::iterator< ft::bidirectional_iterator_tag, T >::pointer
+                pointer;
+            typedef typename ft::iterator< ft::bidirectional_iterator_tag, T >::reference
+                reference;
+
+        protected:
+            btree_node_base* _node;
+            std::size_t _index;
+
+        public:
+            /**
+             * @brief constructeur par défaut
+             */
+            btree_iterator(btree_node_base* node = ft::u_nullptr, std::size_t index = 0)
+                : _node(node), _index(index) {}
+
+            /**
+             * @brief copy / type-cast constructeur
+             */
+            btree_iterator(const btree_iterator& other)
+                : _node(other._node), _index(other._index) {}
+
+            /**
+             * @brief opérateur d'affectation
+             */
+            btree_iterator& operator=(const btree_iterator& other) {
+                this->_node = other._node;
+                this->_index = other._index;
+                return *this;
+            }
+
+            /**
+             * @brief btree_iterator< const T > casting operator
+             */
+            operator btree_iterator< const T, Leaf >() const {
+                return btree_iterator< const T, Leaf >(this->_node, this->_index);
+            }
+
+            /**
+             * @brief Avance à la valeur suivante, dans la feuille suivante
+             * si celle-ci est épuisée.
+             */
+            btree_iterator& operator++() {
+                if (++this->_index == this->_node->count) {
+                    this->_node = this->_node->next;
+                    this->_index = 0;
+                }
+                return *this;
+            }
+
+            btree_iterator operator++(int) {
+                btree_iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            /**
+             * @brief Recule à la valeur précédente, à la fin de la feuille
+             * précédente si l'on est au début d'une feuille.
+             */
+            btree_iterator& operator--() {
+                if (this->_index == 0) {
+                    this->_node = this->_node->prev;
+                    this->_index = this->_node->count;
+                }
+                --this->_index;
+                return *this;
+            }
+
+            btree_iterator operator--(int) {
+                btree_iterator tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            reference operator*() const {
+                return static_cast< Leaf* >(this->_node)->values.data()[this->_index];
+            }
+
+            pointer operator->() const { return &(operator*()); }
+
+            btree_node_base* node() const { return this->_node; }
+
+            std::size_t index() const { return this->_index; }
+    };
+
+    /**
+     * @brief Opérateurs relationnels == et != pour btree_iterator,
+     * entre itérateurs constants ou non.
+     */
+    template < class T1, class T2, class Leaf >
+    bool operator==(const btree_iterator< T1, Leaf >& lhs,
+                    const btree_iterator< T2, Leaf >& rhs) {
+        return lhs.node() == rhs.node() && lhs.index() == rhs.index();
+    }
+
+    template < class T1, class T2, class Leaf >
+    bool operator!=(const btree_iterator< T1, Leaf >& lhs,
+                    const btree_iterator< T2, Leaf >& rhs) {
+        return !(lhs == rhs);
+    }
+}
+
+#endif
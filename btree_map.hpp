@@ -0,0 +1,1007 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _BTREE_MAP_HPP_
+#define _BTREE_MAP_HPP_
+
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "btree.hpp"
+#include "iterator.hpp"
+#include "memory.hpp"
+#include "simd.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft {
+    /**
+     * @brief Conteneur associatif ordonné de paires clé / valeur à clés
+     * uniques, implémenté par un B+arbre.
+     * Chaque noeud range ses clés dans un tableau contigu de quelques lignes
+     * de cache, séparé des valeurs : la recherche dans un noeud lit un seul
+     * bloc de mémoire, et se fait avec les noyaux vectoriels de ft::simd
+     * quand Compare est std::less sur int ou long. Les valeurs sont toutes
+     * dans les feuilles, chaînées entre elles, si bien qu'un parcours
+     * d'intervalle ne remonte jamais dans l'arbre.
+     * Contrairement à ft::map, insert et erase invalident les itérateurs.
+     *
+     * @tparam Key Type des clés.
+     * @tparam T Type des valeurs associées.
+     * @tparam Compare Ordre strict sur les clés, par défaut `std::less<Key>`.
+     * @tparam Alloc Allocateur de `pair<const Key, T>`, relié aux noeuds.
+     */
+    template < class Key, class T, class Compare = std::less< Key >,
+            class Alloc = std::allocator< ft::pair< const Key, T > > >
+    class btree_map {
+        public:
+            /* Le premier paramètre du template (Key) */
+            typedef Key key_type;
+            /* Le deuxième paramètre du template (T) */
+            typedef T mapped_type;
+            /* pair<const key_type, mapped_type> */
+            typedef ft::pair< const key_type, mapped_type > value_type;
+            /* Le troisième paramètre du template (Compare) */
+            typedef Compare key_compare;
+            /* Le quatrième paramètre du template (Alloc) */
+            typedef Alloc allocator_type;
+            typedef typename allocator_type::reference reference;
+            typedef typename allocator_type::const_reference const_reference;
+            typedef typename allocator_type::pointer pointer;
+            typedef typename allocator_type::const_pointer const_pointer;
+            typedef typename allocator_type::size_type size_type;
+
+            /* Nombre maximal de clés par noeud */
+            static const std::size_t node_capacity = ft::btree_node_capacity< Key >::value;
+
+        private:
+            typedef ft::btree_node< key_type, node_capacity > node_type;
+            typedef ft::btree_leaf< key_type, value_type, node_capacity > leaf_type;
+            typedef ft::btree_inner< key_type, node_capacity > inner_type;
+            typedef typename allocator_type::template rebind< leaf_type >::other leaf_allocator;
+            typedef typename allocator_type::template rebind< inner_type >::other inner_allocator;
+
+            /* Nombre minimal de clés d'un noeud autre que la racine */
+            static const std::size_t MIN_KEYS = node_capacity / 2 - 1;
+
+            /* Vrai si la recherche dans un noeud peut utiliser ft::simd */
+            typedef ft::bool_constant<
+                ft::is_same< key_compare, std::less< key_type > >::value &&
+                ft::simd::has_search_kernels< key_type >::value >
+                simd_search;
+
+        public:
+            /* un itérateur bidirectionnel sur value_type */
+            typedef ft::btree_iterator< value_type, leaf_type > iterator;
+            /* un itérateur bidirectionnel sur const value_type */
+            typedef ft::btree_iterator< const value_type, leaf_type > const_iterator;
+            typedef ft::reverse_iterator< iterator > reverse_iterator;
+            typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+
+            typedef typename ft::iterator_traits< iterator >::difference_type difference_type;
+
+            /**
+             * @brief Compare deux value_type selon leurs clés.
+             */
+            class value_compare {
+                    friend class btree_map;
+
+                protected:
+                    Compare comp;
+
+                    value_compare(Compare c) : comp(c) {}
+
+                public:
+                    typedef bool result_type;
+                    typedef value_type first_argument_type;
+                    typedef value_type second_argument_type;
+
+                    bool operator()(const value_type& x, const value_type& y) const {
+                        return comp(x.first, y.first);
+                    }
+            };
+
+        private:
+            key_compare _comp;
+            allocator_type _alloc;
+            leaf_allocator _leaf_alloc;
+            inner_allocator _inner_alloc;
+            node_type* _root;
+            size_type _size;
+            btree_node_base _list;
+
+        public:
+            /**
+             * @brief constructeur de conteneur vide (constructeur par défaut)
+             */
+            explicit btree_map(const key_compare& comp = key_compare(),
+                            const allocator_type& alloc = allocator_type())
+                : _comp(comp), _alloc(alloc), _leaf_alloc(alloc), _inner_alloc(alloc),
+                _root(u_nullptr), _size(0) {
+                ft::btree_list_reset(this->_list);
+            }
+
+            /**
+             * @brief constructeur d'intervalle
+             * Si [first, last) est trié par clés strictement croissantes,
+             * l'arbre est construit niveau par niveau en O(n) ; sinon les
+             * éléments à partir du premier désordre sont insérés un par un.
+             */
+            template < class InputIterator >
+            btree_map(InputIterator first, InputIterator last,
+                    const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type())
+                : _comp(comp), _alloc(alloc), _leaf_alloc(alloc), _inner_alloc(alloc),
+                _root(u_nullptr), _size(0) {
+                ft::btree_list_reset(this->_list);
+                this->_range_init(first, last);
+            }
+
+            /**
+             * @brief constructeur par copie, en O(n) depuis les feuilles de x
+             */
+            btree_map(const btree_map& x)
+                : _comp(x._comp), _alloc(x._alloc), _leaf_alloc(x._leaf_alloc),
+                _inner_alloc(x._inner_alloc), _root(u_nullptr), _size(0) {
+                ft::btree_list_reset(this->_list);
+                this->_range_init(x.begin(), x.end());
+            }
+
+            btree_map& operator=(const btree_map& x) {
+                if (this != &x) {
+                    this->clear();
+                    this->_comp = x._comp;
+                    this->_range_init(x.begin(), x.end());
+                }
+                return *this;
+            }
+
+            ~btree_map() { this->clear(); }
+
+            iterator begin() { return iterator(this->_list.next, 0); }
+
+            const_iterator begin() const {
+                return const_iterator(this->_list.next, 0);
+            }
+
+            iterator end() { return iterator(&this->_list, 0); }
+
+            const_iterator end() const {
+                return const_iterator(const_cast< btree_node_base* >(&this->_list), 0);
+            }
+
+            reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+            const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+            reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+            const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+            bool empty() const { return this->_size == 0; }
+
+            size_type size() const { return this->_size; }
+
+            size_type max_size() const { return this->_alloc.max_size(); }
+
+            /**
+             * @brief Accès à l'élément de clé k, inséré avec une valeur par
+             * défaut s'il n'existe pas.
+             */
+            mapped_type& operator[](const key_type& k) {
+                iterator it = this->find(k);
+                if (it == this->end()) {
+                    it = this->insert(value_type(k, mapped_type())).first;
+                }
+                return it->second;
+            }
+
+            /**
+             * @brief Accès à l'élément de clé k, std::out_of_range s'il n'existe pas.
+             */
+            mapped_type& at(const key_type& k) {
+                iterator it = this->find(k);
+                if (it == this->end()) {
+                    throw std::out_of_range("ft::btree_map");
+                }
+                return it->second;
+            }
+
+            const mapped_type& at(const key_type& k) const {
+                const_iterator it = this->find(k);
+                if (it == this->end()) {
+                    throw std::out_of_range("ft::btree_map");
+                }
+                return it->second;
+            }
+
+            /**
+             * @brief Insère val si sa clé est absente.
+             * Renvoie l'élément de même clé et true s'il a été inséré.
+             * La descente divise d'avance tout noeud plein qu'elle traverse,
+             * si bien que la feuille atteinte a toujours une place libre.
+             * Si la copie de val échoue, la feuille créée pour un arbre vide
+             * est rendue.
+             */
+            ft::pair< iterator, bool > insert(const value_type& val) {
+                if (!this->_root) {
+                    leaf_type* leaf = this->_new_leaf();
+                    ft::btree_list_insert_after(&this->_list, leaf);
+                    this->_root = leaf;
+                }
+                if (this->_root->count == node_capacity) {
+                    inner_type* root = this->_new_inner();
+                    root->children[0] = this->_root;
+                    try {
+                        this->_split_child(root, 0);
+                    }
+                    catch (...) {
+                        this->_inner_alloc.deallocate(root, 1);
+                        throw;
+                    }
+                    this->_root = root;
+                }
+                node_type* x = this->_root;
+                while (!x->leaf) {
+                    inner_type* inner = static_cast< inner_type* >(x);
+                    size_type i = this->_upper_index(inner, val.first);
+                    if (inner->children[i]->count == node_capacity) {
+                        this->_split_child(inner, i);
+                        if (!this->_comp(val.first, inner->keys.data()[i])) {
+                            ++i;
+                        }
+                    }
+                    x = inner->children[i];
+                }
+                leaf_type* leaf = static_cast< leaf_type* >(x);
+                size_type i = this->_lower_index(leaf, val.first);
+                if (i < leaf->count && !this->_comp(val.first, leaf->keys.data()[i])) {
+                    return ft::make_pair(iterator(leaf, i), false);
+                }
+                try {
+                    this->_leaf_insert(leaf, i, val);
+                }
+                catch (...) {
+                    if (leaf->count == 0) {
+                        ft::btree_list_unlink(leaf);
+                        this->_leaf_alloc.deallocate(leaf, 1);
+                        this->_root = u_nullptr;
+                    }
+                    throw;
+                }
+                ++this->_size;
+                return ft::make_pair(iterator(leaf, i), true);
+            }
+
+            /**
+             * @brief Insère val ; position n'est qu'une indication ignorée,
+             * la descente depuis la racine étant déjà en O(log n).
+             */
+            iterator insert(iterator position, const value_type& val) {
+                (void)position;
+                return this->insert(val).first;
+            }
+
+            /**
+             * @brief Insère les éléments de [first, last), en O(n) dans un
+             * conteneur vide si l'intervalle est trié.
+             */
+            template < class InputIterator >
+            void insert(InputIterator first, InputIterator last) {
+                if (this->empty()) {
+                    this->_range_init(first, last);
+                    return;
+                }
+                for (; first != last; ++first) {
+                    this->insert(*first);
+                }
+            }
+
+            void erase(iterator position) {
+                key_type k(position->first);
+                this->erase(k);
+            }
+
+            /**
+             * @brief Supprime l'élément de clé k s'il existe.
+             * La descente complète d'avance tout enfant réduit au minimum de
+             * clés, par emprunt à un voisin ou par fusion, si bien que la
+             * suppression dans la feuille ne demande jamais de remonter.
+             */
+            size_type erase(const key_type& k) {
+                if (!this->_root) {
+                    return 0;
+                }
+                node_type* x = this->_root;
+                while (!x->leaf) {
+                    inner_type* inner = static_cast< inner_type* >(x);
+                    size_type i = this->_upper_index(inner, k);
+                    if (inner->children[i]->count <= MIN_KEYS) {
+                        i = this->_fill_child(inner, i);
+                    }
+                    x = inner->children[i];
+                    if (inner == this->_root && inner->count == 0) {
+                        this->_root = x;
+                        this->_inner_alloc.deallocate(inner, 1);
+                    }
+                }
+                leaf_type* leaf = static_cast< leaf_type* >(x);
+                size_type i = this->_lower_index(leaf, k);
+                if (i == leaf->count || this->_comp(k, leaf->keys.data()[i])) {
+                    return 0;
+                }
+                this->_leaf_erase(leaf, i);
+                --this->_size;
+                if (leaf->count == 0) {
+                    ft::btree_list_unlink(leaf);
+                    this->_leaf_alloc.deallocate(leaf, 1);
+                    this->_root = u_nullptr;
+                }
+                return 1;
+            }
+
+            /**
+             * @brief Supprime [first, last) clé par clé : chaque suppression
+             * invalidant les itérateurs, l'élément suivant est retrouvé par
+             * lower_bound de la clé supprimée.
+             */
+            void erase(iterator first, iterator last) {
+                if (first == this->begin() && last == this->end()) {
+                    this->clear();
+                    return;
+                }
+                difference_type n = ft::distance(first, last);
+                if (n == 0) {
+                    return;
+                }
+                key_type k(first->first);
+                while (true) {
+                    this->erase(k);
+                    if (--n == 0) {
+                        break;
+                    }
+                    k = this->lower_bound(k)->first;
+                }
+            }
+
+            /**
+             * @brief Echange de contenu en temps constant, allocateurs compris
+             */
+            void swap(btree_map& x) {
+                btree_node_base* first = this->_list.next;
+                btree_node_base* last = this->_list.prev;
+                _adopt(this->_list, x._list.next, x._list.prev, &x._list);
+                _adopt(x._list, first, last, &this->_list);
+                ft::swap(this->_root, x._root);
+                ft::swap(this->_size, x._size);
+                ft::swap(this->_comp, x._comp);
+                ft::swap(this->_alloc, x._alloc);
+                ft::swap(this->_leaf_alloc, x._leaf_alloc);
+                ft::swap(this->_inner_alloc, x._inner_alloc);
+            }
+
+            void clear() {
+                this->_destroy_inner(this->_root);
+                this->_destroy_leaves();
+                this->_root = u_nullptr;
+                this->_size = 0;
+            }
+
+            key_compare key_comp() const { return this->_comp; }
+
+            value_compare value_comp() const { return value_compare(this->_comp); }
+
+            iterator find(const key_type& k) {
+                iterator it = this->lower_bound(k);
+                return (it == this->end() || this->_comp(k, it->first)) ? this->end() : it;
+            }
+
+            const_iterator find(const key_type& k) const {
+                const_iterator it = this->lower_bound(k);
+                return (it == this->end() || this->_comp(k, it->first)) ? this->end() : it;
+            }
+
+            size_type count(const key_type& k) const {
+                return this->find(k) == this->end() ? 0 : 1;
+            }
+
+            /**
+             * @brief Premier élément dont la clé n'est pas inférieure à k.
+             */
+            iterator lower_bound(const key_type& k) {
+                leaf_type* leaf = this->_find_leaf(k);
+                return leaf ? this->_at(leaf, this->_lower_index(leaf, k)) : this->end();
+            }
+
+            const_iterator lower_bound(const key_type& k) const {
+                return const_cast< btree_map* >(this)->lower_bound(k);
+            }
+
+            /**
+             * @brief Premier élément dont la clé est supérieure à k.
+             */
+            iterator upper_bound(const key_type& k) {
+                leaf_type* leaf = this->_find_leaf(k);
+                return leaf ? this->_at(leaf, this->_upper_index(leaf, k)) : this->end();
+            }
+
+            const_iterator upper_bound(const key_type& k) const {
+                return const_cast< btree_map* >(this)->upper_bound(k);
+            }
+
+            ft::pair< iterator, iterator > equal_range(const key_type& k) {
+                return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+            }
+
+            ft::pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+                return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+            }
+
+            allocator_type get_allocator() const { return this->_alloc; }
+
+        private:
+            /**
+             * @brief Rattache une liste de feuilles (première et dernière) à la
+             * sentinelle to, ou la réinitialise si la liste est celle, vide,
+             * de la sentinelle from.
+             */
+            static void _adopt(btree_node_base& to, btree_node_base* first, btree_node_base* last,
+                            btree_node_base* from) {
+                if (first == from) {
+                    ft::btree_list_reset(to);
+                    return;
+                }
+                to.next = first;
+                to.prev = last;
+                first->prev = &to;
+                last->next = &to;
+            }
+
+            /**
+             * @brief Itérateur sur la position i de leaf, ou sur le début de
+             * la feuille suivante si leaf est épuisée.
+             */
+            iterator _at(leaf_type* leaf, size_type i) {
+                if (i == leaf->count) {
+                    return iterator(leaf->next, 0);
+                }
+                return iterator(leaf, i);
+            }
+
+            /**
+             * @brief Nombre de clés de x inférieures à k.
+             */
+            size_type _lower_index(const node_type* x, const key_type& k) const {
+                return this->_count_less(x->keys.data(), x->count, k, simd_search());
+            }
+
+            /**
+             * @brief Nombre de clés de x inférieures ou égales à k, soit
+             * l'enfant à suivre dans un noeud interne.
+             */
+            size_type _upper_index(const node_type* x, const key_type& k) const {
+                return x->count - this->_count_greater(x->keys.data(), x->count, k, simd_search());
+            }
+
+            size_type _count_less(const key_type* keys, size_type n, const key_type& k,
+                                ft::true_type) const {
+                return ft::simd::active_search_kernels< key_type >().count_less(keys, n, k);
+            }
+
+            size_type _count_less(const key_type* keys, size_type n, const key_type& k,
+                                ft::false_type) const {
+                size_type lo = 0;
+                while (n > 0) {
+                    size_type half = n / 2;
+                    if (this->_comp(keys[lo + half], k)) {
+                        lo += half + 1;
+                        n -= half + 1;
+                    } else {
+                        n = half;
+                    }
+                }
+                return lo;
+            }
+
+            size_type _count_greater(const key_type* keys, size_type n, const key_type& k,
+                                    ft::true_type) const {
+                return ft::simd::active_search_kernels< key_type >().count_greater(keys, n, k);
+            }
+
+            size_type _count_greater(const key_type* keys, size_type n, const key_type& k,
+                                    ft::false_type) const {
+                size_type total = n;
+                size_type lo = 0;
+                while (n > 0) {
+                    size_type half = n / 2;
+                    if (!this->_comp(k, keys[lo + half])) {
+                        lo += half + 1;
+                        n -= half + 1;
+                    } else {
+                        n = half;
+                    }
+                }
+                return total - lo;
+            }
+
+            /**
+             * @brief Feuille où se trouverait k, nulle si l'arbre est vide.
+             */
+            leaf_type* _find_leaf(const key_type& k) const {
+                node_type* x = this->_root;
+                if (!x) {
+                    return u_nullptr;
+                }
+                while (!x->leaf) {
+                    const inner_type* inner = static_cast< const inner_type* >(x);
+                    x = inner->children[this->_upper_index(inner, k)];
+                }
+                return static_cast< leaf_type* >(x);
+            }
+
+            leaf_type* _new_leaf() {
+                leaf_type* leaf = this->_leaf_alloc.allocate(1);
+                leaf->prev = u_nullptr;
+                leaf->next = u_nullptr;
+                leaf->count = 0;
+                leaf->leaf = true;
+                return leaf;
+            }
+
+            inner_type* _new_inner() {
+                inner_type* inner = this->_inner_alloc.allocate(1);
+                inner->prev = u_nullptr;
+                inner->next = u_nullptr;
+                inner->count = 0;
+                inner->leaf = false;
+                return inner;
+            }
+
+            /**
+             * @brief Ajoute val à la fin de leaf, qui n'est pas pleine.
+             */
+            void _leaf_append(leaf_type* leaf, const value_type& val) {
+                size_type n = leaf->count;
+                this->_alloc.construct(leaf->values.data() + n, val);
+                try {
+                    ::new (static_cast< void* >(leaf->keys.data() + n)) key_type(val.first);
+                }
+                catch (...) {
+                    this->_alloc.destroy(leaf->values.data() + n);
+                    throw;
+                }
+                ++leaf->count;
+            }
+
+            /**
+             * @brief Insère val à la position i de leaf, qui n'est pas pleine,
+             * en décalant la fin de la feuille d'un cran.
+             */
+            void _leaf_insert(leaf_type* leaf, size_type i, const value_type& val) {
+                key_type* keys = leaf->keys.data();
+                value_type* values = leaf->values.data();
+                size_type tail = leaf->count - i;
+                ft::relocate(values + i + 1, values + i, tail);
+                try {
+                    this->_alloc.construct(values + i, val);
+                }
+                catch (...) {
+                    ft::relocate(values + i, values + i + 1, tail);
+                    throw;
+                }
+                ft::relocate(keys + i + 1, keys + i, tail);
+                try {
+                    ::new (static_cast< void* >(keys + i)) key_type(val.first);
+                }
+                catch (...) {
+                    ft::relocate(keys + i, keys + i + 1, tail);
+                    this->_alloc.destroy(values + i);
+                    ft::relocate(values + i, values + i + 1, tail);
+                    throw;
+                }
+                ++leaf->count;
+            }
+
+            /**
+             * @brief Détruit l'élément i de leaf et referme le trou.
+             */
+            void _leaf_erase(leaf_type* leaf, size_type i) {
+                key_type* keys = leaf->keys.data();
+                value_type* values = leaf->values.data();
+                size_type tail = leaf->count - i - 1;
+                keys[i].~key_type();
+                this->_alloc.destroy(values + i);
+                ft::relocate(keys + i, keys + i + 1, tail);
+                ft::relocate(values + i, values + i + 1, tail);
+                --leaf->count;
+            }
+
+            /**
+             * @brief Ouvre la place d'un séparateur en position i et d'un
+             * enfant en position i + 1 dans inner, qui n'est pas plein.
+             */
+            static void _open_slot(inner_type* inner, size_type i) {
+                size_type n = inner->count;
+                ft::relocate(inner->keys.data() + i + 1, inner->keys.data() + i, n - i);
+                for (size_type j = n + 1; j > i + 1; --j) {
+                    inner->children[j] = inner->children[j - 1];
+                }
+            }
+
+            /**
+             * @brief Referme la place du séparateur i, déjà détruit ou
+             * déplacé, et de l'enfant i + 1 de inner.
+             */
+            static void _close_slot(inner_type* inner, size_type i) {
+                size_type n = inner->count;
+                ft::relocate(inner->keys.data() + i, inner->keys.data() + i + 1, n - i - 1);
+                for (size_type j = i + 1; j < n; ++j) {
+                    inner->children[j] = inner->children[j + 1];
+                }
+                --inner->count;
+            }
+
+            /**
+             * @brief Divise en deux moitiés l'enfant plein i de parent, qui
+             * n'est pas plein. Seule l'allocation du nouveau noeud et la copie
+             * du séparateur d'une feuille peuvent lever une exception, avant
+             * toute modification de l'arbre.
+             */
+            void _split_child(inner_type* parent, size_type i) {
+                node_type* child = parent->children[i];
+                const size_type half = node_capacity / 2;
+                if (child->leaf) {
+                    leaf_type* left = static_cast< leaf_type* >(child);
+                    leaf_type* right = this->_new_leaf();
+                    _open_slot(parent, i);
+                    try {
+                        ::new (static_cast< void* >(parent->keys.data() + i))
+                            key_type(left->keys.data()[half]);
+                    }
+                    catch (...) {
+                        ft::relocate(parent->keys.data() + i, parent->keys.data() + i + 1,
+                                    parent->count - i);
+                        for (size_type j = i + 1; j <= parent->count; ++j) {
+                            parent->children[j] = parent->children[j + 1];
+                        }
+                        this->_leaf_alloc.deallocate(right, 1);
+                        throw;
+                    }
+                    ft::relocate(right->keys.data(), left->keys.data() + half,
+                                node_capacity - half);
+                    ft::relocate(right->values.data(), left->values.data() + half,
+                                node_capacity - half);
+                    right->count = node_capacity - half;
+                    left->count = half;
+                    ft::btree_list_insert_after(left, right);
+                    parent->children[i + 1] = right;
+                } else {
+                    inner_type* left = static_cast< inner_type* >(child);
+                    inner_type* right = this->_new_inner();
+                    _open_slot(parent, i);
+                    ft::relocate(parent->keys.data() + i, left->keys.data() + half, 1);
+                    ft::relocate(right->keys.data(), left->keys.data() + half + 1,
+                                node_capacity - half - 1);
+                    for (size_type j = 0; j < node_capacity - half; ++j) {
+                        right->children[j] = left->children[half + 1 + j];
+                    }
+                    right->count = node_capacity - half - 1;
+                    left->count = half;
+                    parent->children[i + 1] = right;
+                }
+                ++parent->count;
+            }
+
+            /**
+             * @brief Donne au moins MIN_KEYS + 1 clés à l'enfant i de parent,
+             * en empruntant une clé à un voisin qui en a plus que le minimum,
+             * sinon en le fusionnant avec un voisin.
+             * Renvoie la nouvelle position de l'enfant.
+             */
+            size_type _fill_child(inner_type* parent, size_type i) {
+                if (i > 0 && parent->children[i - 1]->count > MIN_KEYS) {
+                    this->_borrow_from_left(parent, i);
+                    return i;
+                }
+                if (i < parent->count && parent->children[i + 1]->count > MIN_KEYS) {
+                    this->_borrow_from_right(parent, i);
+                    return i;
+                }
+                if (i > 0) {
+                    this->_merge_children(parent, i - 1);
+                    return i - 1;
+                }
+                this->_merge_children(parent, i);
+                return i;
+            }
+
+            void _borrow_from_left(inner_type* parent, size_type i) {
+                node_type* left = parent->children[i - 1];
+                node_type* child = parent->children[i];
+                size_type last = left->count - 1;
+                key_type* sep = parent->keys.data() + i - 1;
+                if (child->leaf) {
+                    leaf_type* from = static_cast< leaf_type* >(left);
+                    leaf_type* to = static_cast< leaf_type* >(child);
+                    *sep = from->keys.data()[last];
+                    ft::relocate(to->keys.data() + 1, to->keys.data(), to->count);
+                    ft::relocate(to->values.data() + 1, to->values.data(), to->count);
+                    ft::relocate(to->keys.data(), from->keys.data() + last, 1);
+                    ft::relocate(to->values.data(), from->values.data() + last, 1);
+                } else {
+                    inner_type* from = static_cast< inner_type* >(left);
+                    inner_type* to = static_cast< inner_type* >(child);
+                    ft::relocate(to->keys.data() + 1, to->keys.data(), to->count);
+                    for (size_type j = to->count + 1; j > 0; --j) {
+                        to->children[j] = to->children[j - 1];
+                    }
+                    ft::relocate(to->keys.data(), sep, 1);
+                    to->children[0] = from->children[last + 1];
+                    ft::relocate(sep, from->keys.data() + last, 1);
+                }
+                --left->count;
+                ++child->count;
+            }
+
+            void _borrow_from_right(inner_type* parent, size_type i) {
+                node_type* child = parent->children[i];
+                node_type* right = parent->children[i + 1];
+                size_type n = child->count;
+                key_type* sep = parent->keys.data() + i;
+                if (child->leaf) {
+                    leaf_type* from = static_cast< leaf_type* >(right);
+                    leaf_type* to = static_cast< leaf_type* >(child);
+                    *sep = from->keys.data()[1];
+                    ft::relocate(to->keys.data() + n, from->keys.data(), 1);
+                    ft::relocate(to->values.data() + n, from->values.data(), 1);
+                    ft::relocate(from->keys.data(), from->keys.data() + 1, from->count - 1);
+                    ft::relocate(from->values.data(), from->values.data() + 1, from->count - 1);
+                } else {
+                    inner_type* from = static_cast< inner_type* >(right);
+                    inner_type* to = static_cast< inner_type* >(child);
+                    ft::relocate(to->keys.data() + n, sep, 1);
+                    to->children[n + 1] = from->children[0];
+                    ft::relocate(sep, from->keys.data(), 1);
+                    ft::relocate(from->keys.data(), from->keys.data() + 1, from->count - 1);
+                    for (size_type j = 0; j < from->count; ++j) {
+                        from->children[j] = from->children[j + 1];
+                    }
+                }
+                --right->count;
+                ++child->count;
+            }
+
+            /**
+             * @brief Fusionne l'enfant i + 1 de parent dans l'enfant i, tous
+             * deux au minimum de clés, et retire leur séparateur de parent.
+             */
+            void _merge_children(inner_type* parent, size_type i) {
+                node_type* left = parent->children[i];
+                node_type* right = parent->children[i + 1];
+                size_type n = left->count;
+                key_type* sep = parent->keys.data() + i;
+                if (left->leaf) {
+                    leaf_type* to = static_cast< leaf_type* >(left);
+                    leaf_type* from = static_cast< leaf_type* >(right);
+                    ft::relocate(to->keys.data() + n, from->keys.data(), from->count);
+                    ft::relocate(to->values.data() + n, from->values.data(), from->count);
+                    to->count += from->count;
+                    ft::btree_list_unlink(from);
+                    this->_leaf_alloc.deallocate(from, 1);
+                    sep->~key_type();
+                } else {
+                    inner_type* to = static_cast< inner_type* >(left);
+                    inner_type* from = static_cast< inner_type* >(right);
+                    ft::relocate(to->keys.data() + n, sep, 1);
+                    ft::relocate(to->keys.data() + n + 1, from->keys.data(), from->count);
+                    for (size_type j = 0; j <= from->count; ++j) {
+                        to->children[n + 1 + j] = from->children[j];
+                    }
+                    to->count += from->count + 1;
+                    this->_inner_alloc.deallocate(from, 1);
+                }
+                _close_slot(parent, i);
+            }
+
+            /**
+             * @brief Détruit les noeuds internes du sous-arbre x ; les
+             * feuilles sont détruites à part, par la liste.
+             */
+            void _destroy_inner(node_type* x) {
+                if (!x || x->leaf) {
+                    return;
+                }
+                inner_type* inner = static_cast< inner_type* >(x);
+                for (size_type i = 0; i <= inner->count; ++i) {
+                    this->_destroy_inner(inner->children[i]);
+                }
+                this->_free_inner(inner);
+            }
+
+            void _free_inner(inner_type* inner) {
+                for (size_type i = 0; i < inner->count; ++i) {
+                    inner->keys.data()[i].~key_type();
+                }
+                this->_inner_alloc.deallocate(inner, 1);
+            }
+
+            void _destroy_leaves() {
+                btree_node_base* x = this->_list.next;
+                while (x != &this->_list) {
+                    leaf_type* leaf = static_cast< leaf_type* >(x);
+                    x = x->next;
+                    for (size_type i = 0; i < leaf->count; ++i) {
+                        leaf->keys.data()[i].~key_type();
+                        this->_alloc.destroy(leaf->values.data() + i);
+                    }
+                    this->_leaf_alloc.deallocate(leaf, 1);
+                }
+                ft::btree_list_reset(this->_list);
+            }
+
+            static const key_type& _min_key(const node_type* x) {
+                while (!x->leaf) {
+                    x = static_cast< const inner_type* >(x)->children[0];
+                }
+                return x->keys.data()[0];
+            }
+
+            /**
+             * @brief Remplit un conteneur vide. Les feuilles sont remplies
+             * tant que les clés sont strictement croissantes, puis les niveaux
+             * internes sont construits au-dessus en O(n) ; le reste de
+             * l'intervalle, à partir du premier désordre, est inséré élément
+             * par élément.
+             */
+            template < class InputIterator >
+            void _range_init(InputIterator first, InputIterator last) {
+                ft::vector< node_type* > level;
+                ft::vector< inner_type* > inners;
+                try {
+                    leaf_type* tail = u_nullptr;
+                    for (; first != last; ++first) {
+                        if (tail && !this->_comp(tail->keys.data()[tail->count - 1],
+                                                (*first).first)) {
+                            break;
+                        }
+                        if (!tail || tail->count == node_capacity) {
+                            tail = this->_new_leaf();
+                            ft::btree_list_insert_after(this->_list.prev, tail);
+                            level.push_back(tail);
+                        }
+                        this->_leaf_append(tail, *first);
+                        ++this->_size;
+                    }
+                    this->_balance_last_leaf(level);
+                    this->_root = this->_build_levels(level, inners);
+                }
+                catch (...) {
+                    for (size_type i = 0; i < inners.size(); ++i) {
+                        if (inners[i]) {
+                            this->_free_inner(inners[i]);
+                        }
+                    }
+                    this->_destroy_leaves();
+                    this->_size = 0;
+                    throw;
+                }
+                for (; first != last; ++first) {
+                    this->insert(*first);
+                }
+            }
+
+            /**
+             * @brief Rééquilibre les deux dernières feuilles d'une construction
+             * séquentielle, la dernière pouvant avoir moins que le minimum.
+             */
+            void _balance_last_leaf(const ft::vector< node_type* >& level) {
+                size_type n = level.size();
+                if (n < 2 || level[n - 1]->count > MIN_KEYS) {
+                    return;
+                }
+                leaf_type* from = static_cast< leaf_type* >(level[n - 2]);
+                leaf_type* to = static_cast< leaf_type* >(level[n - 1]);
+                size_type moved = (from->count + to->count) / 2 - to->count;
+                size_type start = from->count - moved;
+                ft::relocate(to->keys.data() + moved, to->keys.data(), to->count);
+                ft::relocate(to->values.data() + moved, to->values.data(), to->count);
+                ft::relocate(to->keys.data(), from->keys.data() + start, moved);
+                ft::relocate(to->values.data(), from->values.data() + start, moved);
+                from->count -= moved;
+                to->count += moved;
+            }
+
+            /**
+             * @brief Construit les niveaux internes au-dessus de level et
+             * renvoie la racine. Chaque niveau répartit ses enfants également
+             * entre le plus petit nombre de noeuds possible, ce qui garantit
+             * le minimum de clés à chacun.
+             */
+            node_type* _build_levels(ft::vector< node_type* >& level,
+                                    ft::vector< inner_type* >& inners) {
+                while (level.size() > 1) {
+                    size_type m = level.size();
+                    size_type groups = (m + node_capacity) / (node_capacity + 1);
+                    ft::vector< node_type* > parents;
+                    size_type pos = 0;
+                    for (size_type g = 0; g < groups; ++g) {
+                        size_type take = m / groups + (g < m % groups ? 1 : 0);
+                        inners.push_back(u_nullptr);
+                        inner_type* inner = this->_new_inner();
+                        inners.back() = inner;
+                        inner->children[0] = level[pos];
+                        for (size_type j = 1; j < take; ++j) {
+                            ::new (static_cast< void* >(inner->keys.data() + j - 1))
+                                key_type(_min_key(level[pos + j]));
+                            inner->children[j] = level[pos + j];
+                            ++inner->count;
+                        }
+                        parents.push_back(inner);
+                        pos += take;
+                    }
+                    level.swap(parents);
+                }
+                return level.empty() ? u_nullptr : level[0];
+            }
+    };
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator==(const btree_map< Key, T, Compare, Alloc >& lhs,
+                    const btree_map< Key, T, Compare, Alloc >& rhs) {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator!=(const btree_map< Key, T, Compare, Alloc >& lhs,
+                    const btree_map< Key, T, Compare, Alloc >& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator<(const btree_map< Key, T, Compare, Alloc >& lhs,
+                const btree_map< Key, T, Compare, Alloc >& rhs) {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator<=(const btree_map< Key, T, Compare, Alloc >& lhs,
+                    const btree_map< Key, T, Compare, Alloc >& rhs) {
+        return !(rhs < lhs);
+    }
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator>(const btree_map< Key, T, Compare, Alloc >& lhs,
+                const btree_map< Key, T, Compare, Alloc >& rhs) {
+        return rhs < lhs;
+    }
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator>=(const btree_map< Key, T, Compare, Alloc >& lhs,
+                    const btree_map< Key, T, Compare, Alloc >& rhs) {
+        return !(lhs < rhs);
+    }
+
+    /**
+     * @brief Échanger le contenu de deux btree_map
+     */
+    template < class Key, class T, class Compare, class Alloc >
+    void swap(btree_map< Key, T, Compare, Alloc >& x, btree_map< Key, T, Compare, Alloc >& y) {
+        x.swap(y);
+    }
+}
+
+#endif
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map_bench.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "btree_map.hpp"
+#include "map.hpp"
+
+#include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "bench.hpp"
+
+namespace {
+    /* Nombre de recherches chronométrées par taille */
+    const std::size_t LOOKUPS = 1000000;
+    /* Nombre de parcours d'intervalle et longueur de chacun */
+    const std::size_t SCANS = 10000;
+    const std::size_t SCAN_LENGTH = 100;
+
+    double ms_since(double start) { return (bench::now_ns() - start) / 1e6; }
+
+    /**
+     * @brief Construction depuis un intervalle trié, recherches aléatoires
+     * réussies, puis parcours d'intervalles courts à partir de lower_bound,
+     * avec les mêmes clés pour chaque conteneur.
+     */
+    template < class Map, class Pair >
+    void bench_btree_size(const char* name, std::size_t n) {
+        typedef typename Map::const_iterator const_iterator;
+
+        std::vector< Pair > sorted;
+        sorted.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            sorted.push_back(Pair(static_cast< long >(i * 4), static_cast< long >(i)));
+        }
+
+        double start = bench::now_ns();
+        const Map m(sorted.begin(), sorted.end());
+        double build_ms = ms_since(start);
+
+        bench::lcg rng(n);
+        long found = 0;
+        start = bench::now_ns();
+        for (std::size_t i = 0; i < LOOKUPS; ++i) {
+            found += m.find(static_cast< long >(rng.next(n) * 4))->second;
+        }
+        double find_ms = ms_since(start);
+
+        long sum = 0;
+        start = bench::now_ns();
+        for (std::size_t i = 0; i < SCANS; ++i) {
+            const_iterator it = m.lower_bound(static_cast< long >(rng.next(n * 4)));
+            for (std::size_t j = 0; j < SCAN_LENGTH && it != m.end(); ++j, ++it) {
+                sum += it->second;
+            }
+        }
+        double scan_ms = ms_since(start);
+
+        std::cout << "\t " << name << " " << n << " keys: sorted build " << build_ms
+                << " ms, find " << (find_ms * 1e6 / LOOKUPS) << " ns, scan of "
+                << SCAN_LENGTH << " " << (scan_ms * 1e6 / SCANS) << " ns"
+                << (found + sum == -1 ? " " : "") << std::endl;
+    }
+}
+
+void bench_btree_map(void) {
+    typedef ft::btree_map< long, long > btree_map;
+    typedef ft::map< long, long > ft_map;
+    typedef std::map< long, long > std_map;
+
+    std::cout << "Bench: btree_map vs map vs std::map" << std::endl;
+    for (std::size_t n = 1000; n <= 10000000; n *= 10) {
+        bench_btree_size< btree_map, ft::pair< const long, long > >("ft::btree_map", n);
+        bench_btree_size< ft_map, ft::pair< const long, long > >("ft::map", n);
+        bench_btree_size< std_map, std::pair< const long, long > >("std::map", n);
+    }
+}
@@ -0,0 +1,241 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map_test.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "arena.hpp"
+#include "btree_map.hpp"
+
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    template < class Map, class StdMap >
+    bool same_content(const Map& ft_map, const StdMap& std_map) {
+        if (ft_map.size() != std_map.size()) {
+            return false;
+        }
+        typename Map::const_iterator ft_it = ft_map.begin();
+        typename StdMap::const_iterator std_it = std_map.begin();
+        for (; std_it != std_map.end(); ++ft_it, ++std_it) {
+            if (ft_it->first != std_it->first || ft_it->second != std_it->second) {
+                return false;
+            }
+        }
+        if (ft_it != ft_map.end()) {
+            return false;
+        }
+        typename StdMap::const_reverse_iterator std_rit = std_map.rbegin();
+        typename Map::const_reverse_iterator ft_rit = ft_map.rbegin();
+        for (; std_rit != std_map.rend(); ++ft_rit, ++std_rit) {
+            if (ft_rit->first != std_rit->first) {
+                return false;
+            }
+        }
+        return ft_rit == ft_map.rend();
+    }
+
+    /**
+     * @brief Insertions et suppressions aléatoires sur un domaine de keys
+     * clés, comparées à std::map, avec vérification des bornes.
+     */
+    template < class Map, class StdMap >
+    void random_operations(int operations, int keys) {
+        Map ft_map;
+        StdMap std_map;
+        unsigned long state = 12345;
+        for (int i = 0; i < operations; ++i) {
+            state = state * 6364136223846793005UL + 1442695040888963407UL;
+            int key = static_cast< int >((state >> 33) % static_cast< unsigned long >(keys));
+            if (i % 3 == 2 || (i / 4000) % 2 == 1) {
+                assert(ft_map.erase(key) == std_map.erase(key));
+            } else {
+                bool inserted = ft_map.insert(ft::make_pair(key, i)).second;
+                assert(inserted == std_map.insert(std::make_pair(key, i)).second);
+            }
+            if (i % 997 == 0) {
+                assert(same_content(ft_map, std_map));
+                typename Map::iterator lower = ft_map.lower_bound(key);
+                typename StdMap::iterator std_lower = std_map.lower_bound(key);
+                assert((lower == ft_map.end()) == (std_lower == std_map.end()));
+                if (std_lower != std_map.end()) {
+                    assert(lower->first == std_lower->first);
+                }
+                typename Map::iterator upper = ft_map.upper_bound(key);
+                typename StdMap::iterator std_upper = std_map.upper_bound(key);
+                assert((upper == ft_map.end()) == (std_upper == std_map.end()));
+                if (std_upper != std_map.end()) {
+                    assert(upper->first == std_upper->first);
+                }
+            }
+        }
+        assert(same_content(ft_map, std_map));
+        while (!std_map.empty()) {
+            int key = std_map.begin()->first;
+            assert(ft_map.erase(key) == 1);
+            std_map.erase(key);
+        }
+        assert(ft_map.empty() && ft_map.begin() == ft_map.end());
+    }
+
+    /* Valeur dont la copie échoue tant que fail vaut true */
+    struct fragile {
+        static bool fail;
+
+        fragile() {}
+        fragile(const fragile&) {
+            if (fail) {
+                throw std::runtime_error("fragile");
+            }
+        }
+        fragile& operator=(const fragile&) { return *this; }
+    };
+
+    bool fragile::fail = false;
+}
+
+void test_btree_map_random(void) {
+    std::cout << "\t random operations" << std::endl;
+
+    random_operations< ft::btree_map< int, int >, std::map< int, int > >(40000, 20000);
+    random_operations< ft::btree_map< int, int, std::greater< int > >,
+                    std::map< int, int, std::greater< int > > >(20000, 5000);
+    random_operations< ft::btree_map< long, int >, std::map< long, int > >(20000, 5000);
+}
+
+void test_btree_map_range(void) {
+    std::cout << "\t sorted build / range scan" << std::endl;
+
+    for (int n = 0; n < 300; n += 7) {
+        std::vector< ft::pair< int, int > > sorted;
+        for (int i = 0; i < n; ++i) {
+            sorted.push_back(ft::make_pair(i * 2, i));
+        }
+        ft::btree_map< int, int > built(sorted.begin(), sorted.end());
+        assert(built.size() == static_cast< size_t >(n));
+        for (int i = 0; i < n; i += 3) {
+            assert(built.find(i * 2)->second == i && built.count(i * 2 + 1) == 0);
+            assert(built.erase(i * 2) == 1);
+        }
+        built.insert(ft::make_pair(-1, 0));
+        assert(built.begin()->first == -1);
+    }
+
+    ft::btree_map< int, int > scan;
+    for (int i = 0; i < 10000; ++i) {
+        scan[i * 3] = i;
+    }
+    ft::pair< ft::btree_map< int, int >::iterator, ft::btree_map< int, int >::iterator >
+        range(scan.lower_bound(299), scan.upper_bound(3000));
+    int expected = 100;
+    for (; range.first != range.second; ++range.first, ++expected) {
+        assert(range.first->second == expected);
+    }
+    assert(expected == 1001);
+    assert(scan.equal_range(4).first == scan.equal_range(4).second);
+
+    scan.erase(scan.find(30), scan.find(29700));
+    assert(scan.size() == 10000 - 9890 && scan.find(29700)->second == 9900);
+    assert((++scan.begin())->first == 3 && (--scan.end())->first == 29997);
+}
+
+void test_btree_map_copy(void) {
+    std::cout << "\t copy / swap" << std::endl;
+
+    ft::btree_map< std::string, std::string > first;
+    std::map< std::string, std::string > reference;
+    for (int i = 0; i < 500; ++i) {
+        std::string key(static_cast< size_t >(i % 25) + 1, static_cast< char >('a' + i / 25));
+        first[key] = key + "!";
+        reference[key] = key + "!";
+    }
+    assert(same_content(first, reference));
+    ft::btree_map< std::string, std::string > copy(first);
+    assert(copy == first);
+    copy.erase("a");
+    assert(copy != first && copy > first);
+
+    ft::btree_map< std::string, std::string > other;
+    other["z"] = "zz";
+    ft::swap(other, copy);
+    assert(copy.size() == 1 && other.size() == 499);
+    assert(copy.begin()->second == "zz" && (--copy.end())->first == "z");
+
+    other = first;
+    assert(other == first);
+    other.clear();
+    assert(other.empty() && other.begin() == other.end());
+    other.insert(first.begin(), first.end());
+    assert(other == first);
+
+    try {
+        other.at("missing");
+        assert(false);
+    }
+    catch (const std::out_of_range&) {}
+}
+
+void test_btree_map_allocator(void) {
+    std::cout << "\t exceptions / allocator" << std::endl;
+
+    /* Une insertion qui échoue dans un arbre vide ne laisse pas de feuille vide */
+    ft::btree_map< int, fragile > empty;
+    ft::pair< const int, fragile > value(1, fragile());
+    fragile::fail = true;
+    try {
+        empty.insert(value);
+        assert(false);
+    }
+    catch (const std::runtime_error&) {}
+    fragile::fail = false;
+    assert(empty.empty() && empty.begin() == empty.end());
+    empty.insert(ft::make_pair(2, fragile()));
+    assert(empty.size() == 1 && empty.begin()->first == 2 && ++empty.begin() == empty.end());
+
+    /* swap échange aussi les allocateurs : chaque arbre grandit dans l'arène
+       qui possède ses noeuds */
+    typedef ft::arena_allocator< ft::pair< const int, int > > arena_alloc;
+    ft::arena first_arena;
+    ft::arena second_arena;
+    arena_alloc first_alloc(first_arena);
+    arena_alloc second_alloc(second_arena);
+    ft::btree_map< int, int, std::less< int >, arena_alloc > from_first(std::less< int >(),
+                                                                        first_alloc);
+    ft::btree_map< int, int, std::less< int >, arena_alloc > from_second(std::less< int >(),
+                                                                         second_alloc);
+    from_first[1] = 1;
+    from_second[2] = 2;
+    from_first.swap(from_second);
+    assert(from_first.get_allocator() == second_alloc && from_first.begin()->first == 2);
+    assert(from_second.get_allocator() == first_alloc && from_second.begin()->first == 1);
+    std::size_t first_left = first_arena.remaining();
+    std::size_t second_left = second_arena.remaining();
+    for (int i = 3; i < 500; ++i) {
+        from_first[i] = i;
+    }
+    assert(first_arena.remaining() == first_left && second_arena.remaining() != second_left);
+    ft::swap(from_first, from_second);
+    assert(from_first.get_allocator() == first_alloc && from_first.size() == 1);
+    assert(from_second.get_allocator() == second_alloc && from_second.size() == 498);
+}
+
+void test_btree_map(void) {
+    std::cout << "Test: btree_map" << std::endl;
+
+    test_btree_map_random();
+    test_btree_map_range();
+    test_btree_map_copy();
+    test_btree_map_allocator();
+}
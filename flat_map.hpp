@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_map.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _FLAT_MAP_HPP_
+#define _FLAT_MAP_HPP_
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include "flat_tree.hpp"
+#include "utility.hpp"
+
+namespace ft {
+    /**
+     * @brief Conteneur associatif à clés uniques stocké comme un
+     * ft::vector< ft::pair< Key, T > > trié par clé.
+     * Même interface que ft::map, avec des itérateurs
+     * ft::random_access_iterator ; la clé d'un élément ne doit pas être
+     * modifiée à travers un itérateur.
+     *
+     * @tparam Key Type des clés.
+     * @tparam T Type des valeurs associées.
+     * @tparam Compare Ordre strict sur les clés, par défaut `std::less<Key>`.
+     * @tparam Alloc Allocateur des paires.
+     */
+    template < class Key, class T, class Compare = std::less< Key >,
+            class Alloc = std::allocator< ft::pair< Key, T > > >
+    class flat_map : public flat_tree< Key, ft::pair< Key, T >,
+                                    ft::select_first< ft::pair< Key, T > >, Compare, Alloc > {
+        private:
+            typedef flat_tree< Key, ft::pair< Key, T >, ft::select_first< ft::pair< Key, T > >,
+                            Compare, Alloc >
+                tree_type;
+
+        public:
+            /* Le deuxième paramètre du template (T) */
+            typedef T mapped_type;
+            typedef typename tree_type::key_type key_type;
+            typedef typename tree_type::value_type value_type;
+            typedef typename tree_type::key_compare key_compare;
+            typedef typename tree_type::allocator_type allocator_type;
+            typedef typename tree_type::iterator iterator;
+            typedef typename tree_type::size_type size_type;
+
+            /**
+             * @brief constructeur de conteneur vide (constructeur par défaut)
+             */
+            explicit flat_map(const key_compare& comp = key_compare(),
+                            const allocator_type& alloc = allocator_type())
+                : tree_type(comp, alloc) {}
+
+            /**
+             * @brief constructeur d'intervalle
+             * Trie une copie de [first, last) en O(n log n) ; pour plusieurs
+             * éléments de même clé, le premier est retenu.
+             */
+            template < class InputIterator >
+            flat_map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type())
+                : tree_type(comp, alloc) {
+                this->insert(first, last);
+            }
+
+            flat_map(const flat_map& x) : tree_type(x) {}
+
+            flat_map& operator=(const flat_map& x) {
+                tree_type::operator=(x);
+                return *this;
+            }
+
+            /**
+             * @brief Accès à l'élément de clé k, inséré avec une valeur par
+             * défaut s'il n'existe pas.
+             */
+            mapped_type& operator[](const key_type& k) {
+                size_type index = this->_lower_bound(k);
+                if (index == this->size() || this->_comp(k, this->_key(index))) {
+                    this->_data.insert(this->_data.begin() + index, value_type(k, mapped_type()));
+                }
+                return this->_data[index].second;
+            }
+
+            /**
+             * @brief Accès à l'élément de clé k, std::out_of_range s'il n'existe pas.
+             */
+            mapped_type& at(const key_type& k) {
+                size_type index = this->_find(k);
+                if (index == this->size()) {
+                    throw std::out_of_range("ft::flat_map");
+                }
+                return this->_data[index].second;
+            }
+
+            const mapped_type& at(const key_type& k) const {
+                size_type index = this->_find(k);
+                if (index == this->size()) {
+                    throw std::out_of_range("ft::flat_map");
+                }
+                return this->_data[index].second;
+            }
+    };
+
+    /**
+     * @brief Échanger le contenu de deux flat_map
+     */
+    template < class Key, class T, class Compare, class Alloc >
+    void swap(flat_map< Key, T, Compare, Alloc >& x, flat_map< Key, T, Compare, Alloc >& y) {
+        x.swap(y);
+    }
+}
+
+#endif
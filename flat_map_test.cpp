@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_map_test.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "flat_map.hpp"
+#include "flat_set.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+    template < class FlatMap, class StdMap >
+    bool same_content(const FlatMap& flat, const StdMap& std_map) {
+        if (flat.size() != std_map.size()) {
+            return false;
+        }
+        typename FlatMap::const_iterator it = flat.begin();
+        typename StdMap::const_iterator std_it = std_map.begin();
+        for (; std_it != std_map.end(); ++it, ++std_it) {
+            if (it->first != std_it->first || it->second != std_it->second) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+void test_flat_map(void) {
+    std::cout << "Test: flat_map" << std::endl;
+
+    ft::flat_map< int, std::string > flat;
+    std::map< int, std::string > std_map;
+    unsigned long state = 99;
+    for (int i = 0; i < 2000; ++i) {
+        state = state * 6364136223846793005UL + 1442695040888963407UL;
+        int key = static_cast< int >((state >> 33) % 500);
+        std::string value(static_cast< size_t >(i % 7) + 1, 'v');
+        if (i % 4 == 3) {
+            assert(flat.erase(key) == std_map.erase(key));
+        } else if (i % 4 == 2) {
+            flat[key] = value;
+            std_map[key] = value;
+        } else {
+            bool inserted = flat.insert(ft::make_pair(key, value)).second;
+            assert(inserted == std_map.insert(std::make_pair(key, value)).second);
+        }
+    }
+    assert(same_content(flat, std_map));
+    assert(flat.lower_bound(250)->first == std_map.lower_bound(250)->first);
+    assert(flat.upper_bound(250)->first == std_map.upper_bound(250)->first);
+    assert(flat.count(std_map.begin()->first) == 1 && flat.find(1000) == flat.end());
+
+    /* insert(first, last) fusionne un lot désordonné, avec doublons */
+    std::vector< ft::pair< int, std::string > > batch;
+    for (int i = 0; i < 300; ++i) {
+        int key = (i * 7919) % 1200 - 100;
+        batch.push_back(ft::make_pair(key, std::string("batch")));
+        std_map.insert(std::make_pair(key, std::string("batch")));
+    }
+    batch.push_back(ft::make_pair(-100, std::string("duplicate")));
+    flat.insert(batch.begin(), batch.end());
+    assert(same_content(flat, std_map) && flat[-100] == "batch");
+
+    ft::flat_map< int, std::string > built(batch.begin(), batch.end());
+    assert(built.size() == 300 && built.begin()->first == -100);
+    ft::flat_map< int, std::string >::iterator it = built.begin() + 10;
+    assert((it - built.begin()) == 10 && (it + 5)->first > it->first);
+
+    ft::flat_map< int, std::string > copy(built);
+    assert(copy == built);
+    copy.erase(copy.begin(), copy.begin() + 100);
+    assert(copy.size() == 200 && copy > built);
+    ft::swap(copy, built);
+    assert(built.size() == 200 && copy.size() == 300);
+    assert(copy.at(-100) == "batch");
+    try {
+        copy.at(5000);
+        assert(false);
+    }
+    catch (const std::out_of_range&) {}
+}
+
+void test_flat_set(void) {
+    std::cout << "Test: flat_set" << std::endl;
+
+    int values[] = {5, 3, 9, 3, 1, 5, 7};
+    ft::flat_set< int > set(values, values + 7);
+    assert(set.size() == 5 && *set.begin() == 1 && *set.rbegin() == 9);
+
+    std::set< int > std_set(values, values + 7);
+    for (int i = 0; i < 100; i += 3) {
+        assert(set.insert(i).second == std_set.insert(i).second);
+    }
+    set.insert(values, values + 7);
+    assert(set.size() == std_set.size());
+    std::set< int >::iterator std_it = std_set.begin();
+    for (ft::flat_set< int >::iterator it = set.begin(); it != set.end(); ++it, ++std_it) {
+        assert(*it == *std_it);
+    }
+    assert(set.erase(9) == 1 && set.erase(9) == 0 && set.count(7) == 1);
+    set.erase(set.find(7));
+    assert(set.find(7) == set.end() && set.insert(set.begin(), 7) != set.end());
+}
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_set.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _FLAT_SET_HPP_
+#define _FLAT_SET_HPP_
+
+#include <functional>
+#include <memory>
+
+#include "flat_tree.hpp"
+
+namespace ft {
+    /**
+     * @brief Ensemble ordonné de clés uniques stocké comme un ft::vector
+     * trié. Ses itérateurs ft::random_access_iterator sont constants.
+     *
+     * @tparam Key Type des clés.
+     * @tparam Compare Ordre strict sur les clés, par défaut `std::less<Key>`.
+     * @tparam Alloc Allocateur des clés.
+     */
+    template < class Key, class Compare = std::less< Key >, class Alloc = std::allocator< Key > >
+    class flat_set : public flat_tree< Key, Key, ft::identity< Key >, Compare, Alloc > {
+        private:
+            typedef flat_tree< Key, Key, ft::identity< Key >, Compare, Alloc > tree_type;
+
+        public:
+            typedef typename tree_type::key_compare key_compare;
+            typedef typename tree_type::allocator_type allocator_type;
+
+            /**
+             * @brief constructeur de conteneur vide (constructeur par défaut)
+             */
+            explicit flat_set(const key_compare& comp = key_compare(),
+                            const allocator_type& alloc = allocator_type())
+                : tree_type(comp, alloc) {}
+
+            /**
+             * @brief constructeur d'intervalle
+             * Trie une copie de [first, last) en O(n log n) et en retire les doublons.
+             */
+            template < class InputIterator >
+            flat_set(InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type())
+                : tree_type(comp, alloc) {
+                this->insert(first, last);
+            }
+
+            flat_set(const flat_set& x) : tree_type(x) {}
+
+            flat_set& operator=(const flat_set& x) {
+                tree_type::operator=(x);
+                return *this;
+            }
+    };
+
+    /**
+     * @brief Échanger le contenu de deux flat_set
+     */
+    template < class Key, class Compare, class Alloc >
+    void swap(flat_set< Key, Compare, Alloc >& x, flat_set< Key, Compare, Alloc >& y) {
+        x.swap(y);
+    }
+}
+
+#endif
@@ -0,0 +1,422 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_tree.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _FLAT_TREE_HPP_
+#define _FLAT_TREE_HPP_
+
+#include <algorithm>
+#include <memory>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Extrait la clé d'une paire : son premier membre.
+     */
+    template < class Pair >
+    struct select_first {
+        const typename Pair::first_type& operator()(const Pair& x) const { return x.first; }
+    };
+
+    /**
+     * @brief Extrait la clé d'une valeur qui est sa propre clé.
+     */
+    template < class T >
+    struct identity {
+        const T& operator()(const T& x) const { return x; }
+    };
+
+    /**
+     * @brief Base commune de flat_map et flat_set : des valeurs à clés
+     * uniques rangées dans un ft::vector trié par clé.
+     * Les recherches sont des recherches dichotomiques sur un bloc contigu,
+     * et insert(first, last) trie le lot puis le fusionne au contenu en un
+     * seul passage, chaque élément existant n'étant déplacé qu'une fois.
+     * Insérer ou supprimer un élément isolé reste en O(n).
+     *
+     * @tparam Key Type des clés.
+     * @tparam Value Type des valeurs stockées.
+     * @tparam KeyOfValue Foncteur qui extrait la clé d'une valeur.
+     * @tparam Compare Ordre strict sur les clés.
+     * @tparam Alloc Allocateur des valeurs.
+     */
+    template < class Key, class Value, class KeyOfValue, class Compare, class Alloc >
+    class flat_tree {
+        public:
+            typedef Key key_type;
+            typedef Value value_type;
+            typedef Compare key_compare;
+            typedef Alloc allocator_type;
+            /* Le vecteur trié qui stocke les valeurs */
+            typedef ft::vector< value_type, allocator_type > container_type;
+            typedef typename container_type::reference reference;
+            typedef typename container_type::const_reference const_reference;
+            typedef typename container_type::pointer pointer;
+            typedef typename container_type::const_pointer const_pointer;
+            typedef typename container_type::size_type size_type;
+            typedef typename container_type::difference_type difference_type;
+
+            /* un itérateur d'accès aléatoire à const value_type */
+            typedef typename container_type::const_iterator const_iterator;
+            /* un itérateur d'accès aléatoire à value_type, constant si la
+            valeur est sa propre clé (flat_set) */
+            typedef typename ft::conditional< ft::is_same< Key, Value >::value, const_iterator,
+                                            typename container_type::iterator >::type iterator;
+            typedef ft::reverse_iterator< iterator > reverse_iterator;
+            typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+
+            /**
+             * @brief Compare deux valeurs selon leurs clés.
+             */
+            class value_compare {
+                protected:
+                    Compare comp;
+
+                public:
+                    typedef bool result_type;
+                    typedef value_type first_argument_type;
+                    typedef value_type second_argument_type;
+
+                    value_compare(Compare c) : comp(c) {}
+
+                    bool operator()(const value_type& x, const value_type& y) const {
+                        return comp(KeyOfValue()(x), KeyOfValue()(y));
+                    }
+            };
+
+        protected:
+            container_type _data;
+            key_compare _comp;
+
+        public:
+            explicit flat_tree(const key_compare& comp = key_compare(),
+                            const allocator_type& alloc = allocator_type())
+                : _data(alloc), _comp(comp) {}
+
+            flat_tree(const flat_tree& x) : _data(x._data), _comp(x._comp) {}
+
+            flat_tree& operator=(const flat_tree& x) {
+                if (this != &x) {
+                    this->_data = x._data;
+                    this->_comp = x._comp;
+                }
+                return *this;
+            }
+
+            iterator begin() { return this->_data.begin(); }
+
+            const_iterator begin() const { return this->_data.begin(); }
+
+            iterator end() { return this->_data.end(); }
+
+            const_iterator end() const { return this->_data.end(); }
+
+            reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+            const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+            reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+            const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+            bool empty() const { return this->_data.empty(); }
+
+            size_type size() const { return this->_data.size(); }
+
+            size_type max_size() const { return this->_data.max_size(); }
+
+            size_type capacity() const { return this->_data.capacity(); }
+
+            void reserve(size_type n) { this->_data.reserve(n); }
+
+            /**
+             * @brief Insère val si sa clé est absente.
+             * Renvoie l'élément de même clé et true s'il a été inséré.
+             */
+            ft::pair< iterator, bool > insert(const value_type& val) {
+                size_type index = this->_lower_bound(KeyOfValue()(val));
+                if (index != this->size() && !this->_comp(KeyOfValue()(val), this->_key(index))) {
+                    return ft::make_pair(iterator(this->begin() + index), false);
+                }
+                this->_data.insert(this->_data.begin() + index, val);
+                return ft::make_pair(iterator(this->begin() + index), true);
+            }
+
+            /**
+             * @brief Insère val ; position n'est qu'une indication, utilisée
+             * si val se place juste devant elle.
+             */
+            iterator insert(const_iterator position, const value_type& val) {
+                size_type index = this->_index_of(position);
+                const key_type& k = KeyOfValue()(val);
+                if ((index == this->size() || this->_comp(k, this->_key(index))) &&
+                    (index == 0 || this->_comp(this->_key(index - 1), k))) {
+                    this->_data.insert(this->_data.begin() + index, val);
+                    return this->begin() + index;
+                }
+                return this->insert(val).first;
+            }
+
+            /**
+             * @brief Insère les éléments de [first, last).
+             * Le lot est copié puis trié de façon stable par indices (le
+             * premier de plusieurs éléments de même clé est retenu), débarrassé
+             * des clés déjà présentes, ajouté en fin de vecteur et fusionné
+             * depuis la fin : O(m log m + m log n) comparaisons et au plus
+             * n + m affectations.
+             */
+            template < class InputIterator >
+            void insert(InputIterator first, InputIterator last) {
+                container_type batch(first, last, this->_data.get_allocator());
+                if (batch.empty()) {
+                    return;
+                }
+                ft::vector< size_type > order(batch.size());
+                for (size_type i = 0; i < order.size(); ++i) {
+                    order[i] = i;
+                }
+                std::stable_sort(&order[0], &order[0] + order.size(),
+                                index_compare(&batch[0], this->_comp));
+                order.erase(order.begin() + this->_drop_duplicates(batch, order), order.end());
+
+                size_type prev_size = this->size();
+                this->_data.reserve(prev_size + order.size());
+                for (size_type j = 0; j < order.size(); ++j) {
+                    this->_data.push_back(batch[order[j]]);
+                }
+                if (prev_size == 0 || order.empty()) {
+                    return;
+                }
+
+                /* fusion arrière : l'écriture ne rattrape jamais la lecture */
+                pointer data = &this->_data[0];
+                size_type i = prev_size;
+                size_type j = order.size();
+                size_type k = this->size();
+                while (j > 0 && i > 0) {
+                    const value_type& next = batch[order[j - 1]];
+                    if (this->_comp(KeyOfValue()(next), KeyOfValue()(data[i - 1]))) {
+                        data[--k] = data[--i];
+                    } else {
+                        data[--k] = next;
+                        --j;
+                    }
+                }
+                while (j > 0) {
+                    data[--k] = batch[order[--j]];
+                }
+            }
+
+            void erase(const_iterator position) {
+                this->_data.erase(this->_data.begin() + this->_index_of(position));
+            }
+
+            size_type erase(const key_type& k) {
+                size_type index = this->_lower_bound(k);
+                if (index == this->size() || this->_comp(k, this->_key(index))) {
+                    return 0;
+                }
+                this->_data.erase(this->_data.begin() + index);
+                return 1;
+            }
+
+            void erase(const_iterator first, const_iterator last) {
+                this->_data.erase(this->_data.begin() + this->_index_of(first),
+                                this->_data.begin() + this->_index_of(last));
+            }
+
+            void swap(flat_tree& x) {
+                this->_data.swap(x._data);
+                ft::swap(this->_comp, x._comp);
+            }
+
+            void clear() { this->_data.clear(); }
+
+            key_compare key_comp() const { return this->_comp; }
+
+            value_compare value_comp() const { return value_compare(this->_comp); }
+
+            iterator find(const key_type& k) {
+                size_type index = this->_find(k);
+                return this->begin() + index;
+            }
+
+            const_iterator find(const key_type& k) const {
+                size_type index = this->_find(k);
+                return this->begin() + index;
+            }
+
+            size_type count(const key_type& k) const { return this->_find(k) != this->size(); }
+
+            iterator lower_bound(const key_type& k) { return this->begin() + this->_lower_bound(k); }
+
+            const_iterator lower_bound(const key_type& k) const {
+                return this->begin() + this->_lower_bound(k);
+            }
+
+            iterator upper_bound(const key_type& k) { return this->begin() + this->_upper_bound(k); }
+
+            const_iterator upper_bound(const key_type& k) const {
+                return this->begin() + this->_upper_bound(k);
+            }
+
+            ft::pair< iterator, iterator > equal_range(const key_type& k) {
+                return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+            }
+
+            ft::pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+                return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+            }
+
+            allocator_type get_allocator() const { return this->_data.get_allocator(); }
+
+            /**
+             * @brief Le vecteur trié sous-jacent, en lecture seule.
+             */
+            const container_type& container() const { return this->_data; }
+
+        protected:
+            const key_type& _key(size_type index) const {
+                return KeyOfValue()(this->_data[index]);
+            }
+
+            size_type _index_of(const_iterator position) const {
+                return static_cast< size_type >(position - this->_data.begin());
+            }
+
+            /**
+             * @brief Indice du premier élément dont la clé n'est pas inférieure à k.
+             */
+            size_type _lower_bound(const key_type& k) const { return this->_lower_bound_from(0, k); }
+
+            /**
+             * @brief Comme _lower_bound, en ne cherchant qu'à partir de l'indice from.
+             */
+            size_type _lower_bound_from(size_type from, const key_type& k) const {
+                size_type first = from;
+                size_type count = this->size() - from;
+                while (count > 0) {
+                    size_type half = count / 2;
+                    if (this->_comp(this->_key(first + half), k)) {
+                        first += half + 1;
+                        count -= half + 1;
+                    } else {
+                        count = half;
+                    }
+                }
+                return first;
+            }
+
+            /**
+             * @brief Indice du premier élément dont la clé est supérieure à k.
+             */
+            size_type _upper_bound(const key_type& k) const {
+                size_type first = 0;
+                size_type count = this->size();
+                while (count > 0) {
+                    size_type half = count / 2;
+                    if (!this->_comp(k, this->_key(first + half))) {
+                        first += half + 1;
+                        count -= half + 1;
+                    } else {
+                        count = half;
+                    }
+                }
+                return first;
+            }
+
+            /**
+             * @brief Indice de l'élément de clé k, size() s'il est absent.
+             */
+            size_type _find(const key_type& k) const {
+                size_type index = this->_lower_bound(k);
+                if (index == this->size() || this->_comp(k, this->_key(index))) {
+                    return this->size();
+                }
+                return index;
+            }
+
+            /**
+             * @brief Compare deux indices d'un lot selon les clés des valeurs.
+             */
+            struct index_compare {
+                const value_type* values;
+                key_compare comp;
+
+                index_compare(const value_type* v, const key_compare& c) : values(v), comp(c) {}
+
+                bool operator()(size_type a, size_type b) const {
+                    return comp(KeyOfValue()(values[a]), KeyOfValue()(values[b]));
+                }
+            };
+
+            /**
+             * @brief Compacte les indices triés order en ne gardant que le
+             * premier élément de chaque clé, et seulement si la clé est absente
+             * du conteneur. Les recherches reprennent là où la précédente s'est
+             * arrêtée. Renvoie le nombre d'indices conservés.
+             */
+            size_type _drop_duplicates(const container_type& batch, ft::vector< size_type >& order) {
+                size_type kept = 0;
+                size_type lower = 0;
+                for (size_type i = 0; i < order.size(); ++i) {
+                    const key_type& k = KeyOfValue()(batch[order[i]]);
+                    if (kept != 0 && !this->_comp(KeyOfValue()(batch[order[kept - 1]]), k)) {
+                        continue;
+                    }
+                    lower = this->_lower_bound_from(lower, k);
+                    if (lower != this->size() && !this->_comp(k, this->_key(lower))) {
+                        continue;
+                    }
+                    order[kept++] = order[i];
+                }
+                return kept;
+            }
+    };
+
+    template < class K, class V, class KoV, class C, class A >
+    bool operator==(const flat_tree< K, V, KoV, C, A >& lhs, const flat_tree< K, V, KoV, C, A >& rhs) {
+        return lhs.container() == rhs.container();
+    }
+
+    template < class K, class V, class KoV, class C, class A >
+    bool operator!=(const flat_tree< K, V, KoV, C, A >& lhs, const flat_tree< K, V, KoV, C, A >& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template < class K, class V, class KoV, class C, class A >
+    bool operator<(const flat_tree< K, V, KoV, C, A >& lhs, const flat_tree< K, V, KoV, C, A >& rhs) {
+        return lhs.container() < rhs.container();
+    }
+
+    template < class K, class V, class KoV, class C, class A >
+    bool operator<=(const flat_tree< K, V, KoV, C, A >& lhs, const flat_tree< K, V, KoV, C, A >& rhs) {
+        return !(rhs < lhs);
+    }
+
+    template < class K, class V, class KoV, class C, class A >
+    bool operator>(const flat_tree< K, V, KoV, C, A >& lhs, const flat_tree< K, V, KoV, C, A >& rhs) {
+        return rhs < lhs;
+    }
+
+    template < class K, class V, class KoV, class C, class A >
+    bool operator>=(const flat_tree< K, V, KoV, C, A >& lhs, const flat_tree< K, V, KoV, C, A >& rhs) {
+        return !(lhs < rhs);
+    }
+}
+
+#endif
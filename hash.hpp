@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _HASH_HPP_
+#define _HASH_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include "type_traits.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Mélange les bits de x (finaliseur de MurmurHash3) : chaque bit
+     * de l'entrée influence tous les bits de la sortie, ce qui rend les bits
+     * de poids faible comme de poids fort utilisables par une table.
+     */
+    inline std::size_t hash_mix(unsigned long x) {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdUL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53UL;
+        x ^= x >> 33;
+        return static_cast< std::size_t >(x);
+    }
+
+    /**
+     * @brief Hache len octets par mots de 8, lus avec memcpy pour supporter
+     * n'importe quel alignement.
+     */
+    inline std::size_t hash_bytes(const void* data, std::size_t len, std::size_t seed = 0) {
+        const unsigned long mul = 0x9e3779b97f4a7c15UL;
+        const unsigned char* p = static_cast< const unsigned char* >(data);
+        unsigned long h = seed ^ (len * mul);
+        for (; len >= sizeof(unsigned long); len -= sizeof(unsigned long)) {
+            unsigned long word;
+            std::memcpy(&word, p, sizeof(word));
+            p += sizeof(word);
+            word *= mul;
+            word ^= word >> 29;
+            h = (h ^ word) * mul;
+        }
+        if (len > 0) {
+            unsigned long word = 0;
+            std::memcpy(&word, p, len);
+            word *= mul;
+            word ^= word >> 29;
+            h = (h ^ word) * mul;
+        }
+        return hash_mix(h);
+    }
+
+    template < class T, bool Integral = is_integral< T >::value >
+    struct hash_base {};
+
+    template < class T >
+    struct hash_base< T, true > {
+        typedef T argument_type;
+        typedef std::size_t result_type;
+
+        std::size_t operator()(T value) const {
+            return hash_mix(static_cast< unsigned long >(value));
+        }
+    };
+
+    /**
+     * @brief Fonction de hachage par défaut des conteneurs non ordonnés.
+     * Définie pour les types intégraux, les pointeurs (leur adresse) et
+     * std::string (ses octets) ; un autre type doit la spécialiser ou
+     * fournir son propre Hash.
+     *
+     * @tparam T type des clés
+     */
+    template < class T >
+    struct hash : public hash_base< T > {};
+
+    template < class T >
+    struct hash< T* > {
+        typedef T* argument_type;
+        typedef std::size_t result_type;
+
+        std::size_t operator()(T* p) const {
+            return hash_mix(reinterpret_cast< unsigned long >(p));
+        }
+    };
+
+    template <>
+    struct hash< std::string > {
+        typedef std::string argument_type;
+        typedef std::size_t result_type;
+
+        std::size_t operator()(const std::string& str) const {
+            return hash_bytes(str.data(), str.size());
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,333 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   huge_page_allocator.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _HUGE_PAGE_ALLOCATOR_HPP_
+#define _HUGE_PAGE_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define FT_HUGE_PAGE_MMAP 1
+#endif
+
+#include "memory.hpp"
+#include "util.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Gestion des blocs de ft::huge_page_allocator, indépendante du
+     * type des éléments. Un bloc de moins de MMAP_THRESHOLD octets vient de
+     * malloc ; au-delà il est projeté par mmap, par multiples de pages,
+     * marqué MADV_HUGEPAGE et agrandi par mremap. Le chemin d'un bloc se
+     * déduit de sa taille, que l'appelant fournit à chaque opération.
+     * Hors Linux, tous les blocs viennent de malloc.
+     */
+    struct huge_page_blocks {
+        static const std::size_t MMAP_THRESHOLD = std::size_t(1) << 20;
+        static const std::size_t HUGE_PAGE_SIZE = std::size_t(2) << 20;
+
+        static bool is_mapped(std::size_t bytes) {
+#ifdef FT_HUGE_PAGE_MMAP
+            return bytes >= MMAP_THRESHOLD;
+#else
+            (void)bytes;
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Taille réellement projetée pour un bloc de bytes octets : un
+         * multiple de la page, ou de la grande page dès qu'il en dépasse une.
+         * Pour tout count * sizeof(T) compris entre bytes et mapped_size(bytes),
+         * mapped_size donne la même projection, tant que sizeof(T) ne
+         * dépasse pas une page.
+         */
+        static std::size_t mapped_size(std::size_t bytes) {
+            if (!is_mapped(bytes)) {
+                return bytes;
+            }
+#ifdef FT_HUGE_PAGE_MMAP
+            std::size_t granularity = static_cast< std::size_t >(sysconf(_SC_PAGESIZE));
+            if (bytes >= HUGE_PAGE_SIZE) {
+                granularity = HUGE_PAGE_SIZE;
+            }
+            return (bytes + granularity - 1) / granularity * granularity;
+#else
+            return bytes;
+#endif
+        }
+
+        /**
+         * @brief Alloue bytes octets (bytes doit être le résultat de
+         * mapped_size pour un bloc projeté).
+         */
+        static void* allocate(std::size_t bytes) {
+            if (!is_mapped(bytes)) {
+                void* p = std::malloc(bytes ? bytes : 1);
+                if (!p) {
+                    throw std::bad_alloc();
+                }
+                return p;
+            }
+#ifdef FT_HUGE_PAGE_MMAP
+            if (bytes < HUGE_PAGE_SIZE) {
+                return map(bytes);
+            }
+            /* Projette une grande page de plus pour aligner le début du bloc */
+            char* raw = static_cast< char* >(map(bytes + HUGE_PAGE_SIZE));
+            std::size_t misalignment = reinterpret_cast< std::size_t >(raw) % HUGE_PAGE_SIZE;
+            std::size_t head = misalignment ? HUGE_PAGE_SIZE - misalignment : 0;
+            if (head) {
+                munmap(raw, head);
+            }
+            if (HUGE_PAGE_SIZE - head) {
+                munmap(raw + head + bytes, HUGE_PAGE_SIZE - head);
+            }
+            madvise(raw + head, bytes, MADV_HUGEPAGE);
+            return raw + head;
+#else
+            return u_nullptr;
+#endif
+        }
+
+        static void deallocate(void* p, std::size_t bytes) {
+            if (!p) {
+                return;
+            }
+#ifdef FT_HUGE_PAGE_MMAP
+            if (is_mapped(bytes)) {
+                munmap(p, bytes);
+                return;
+            }
+#endif
+            std::free(p);
+        }
+
+        /**
+         * @brief Agrandit en place un bloc projeté de old_bytes à new_bytes
+         * octets (tailles projetées), si les pages suivantes sont libres.
+         */
+        static bool try_expand(void* p, std::size_t old_bytes, std::size_t new_bytes) {
+#ifdef FT_HUGE_PAGE_MMAP
+            if (!is_mapped(old_bytes) || !is_mapped(new_bytes)) {
+                return false;
+            }
+            if (new_bytes <= old_bytes) {
+                return true;
+            }
+            return mremap(p, old_bytes, new_bytes, 0) != MAP_FAILED;
+#else
+            (void)p;
+            (void)old_bytes;
+            (void)new_bytes;
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Déplace le bloc p de old_bytes octets vers un bloc de
+         * new_bytes octets (tailles projetées), en conservant le contenu
+         * commun. Entre deux blocs projetés, mremap déplace les pages sans
+         * copier un seul octet.
+         */
+        static void* reallocate(void* p, std::size_t old_bytes, std::size_t new_bytes) {
+#ifdef FT_HUGE_PAGE_MMAP
+            if (is_mapped(old_bytes) && is_mapped(new_bytes)) {
+                void* next = mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE);
+                if (next == MAP_FAILED) {
+                    throw std::bad_alloc();
+                }
+                madvise(next, new_bytes, MADV_HUGEPAGE);
+                return next;
+            }
+#endif
+            if (!is_mapped(old_bytes) && !is_mapped(new_bytes)) {
+                void* next = std::realloc(p, new_bytes ? new_bytes : 1);
+                if (!next) {
+                    throw std::bad_alloc();
+                }
+                return next;
+            }
+            void* next = allocate(new_bytes);
+            std::memcpy(next, p, old_bytes < new_bytes ? old_bytes : new_bytes);
+            deallocate(p, old_bytes);
+            return next;
+        }
+
+#ifdef FT_HUGE_PAGE_MMAP
+    private:
+        static void* map(std::size_t bytes) {
+            void* p = mmap(u_nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                        -1, 0);
+            if (p == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            return p;
+        }
+#endif
+    };
+
+    /**
+     * @brief Allocateur sans état pour les très grands tampons : les blocs
+     * d'au moins 1 Mio sont projetés par mmap en grandes pages
+     * transparentes (madvise) et, avec ft::vector, grandissent par mremap :
+     * les éléments trivialement relogeables ne sont jamais copiés, et
+     * l'ancien et le nouveau tampon ne coexistent pas en mémoire. La
+     * capacité d'un tel vecteur suit la taille projetée, arrondie à la
+     * page ou à la grande page.
+     *
+     * @tparam T Type des éléments alloués.
+     */
+    template < class T >
+    class huge_page_allocator {
+        public:
+            typedef T value_type;
+            typedef T* pointer;
+            typedef const T* const_pointer;
+            typedef T& reference;
+            typedef const T& const_reference;
+            typedef std::size_t size_type;
+            typedef std::ptrdiff_t difference_type;
+
+            template < class U >
+            struct rebind {
+                typedef huge_page_allocator< U > other;
+            };
+
+            huge_page_allocator() {}
+
+            huge_page_allocator(const huge_page_allocator&) {}
+
+            template < class U >
+            huge_page_allocator(const huge_page_allocator< U >&) {}
+
+            ~huge_page_allocator() {}
+
+            huge_page_allocator& operator=(const huge_page_allocator&) { return *this; }
+
+            pointer address(reference x) const { return &x; }
+
+            const_pointer address(const_reference x) const { return &x; }
+
+            /**
+             * @brief Alloue n éléments. Un bloc projeté est arrondi à la page :
+             * deallocate(p, n) retrouve la même projection à partir de n.
+             */
+            pointer allocate(size_type n, const void* = 0) {
+                size_type count;
+                return this->allocate_at_least(n, count);
+            }
+
+            void deallocate(pointer p, size_type n) {
+                huge_page_blocks::deallocate(p, huge_page_blocks::mapped_size(n * sizeof(T)));
+            }
+
+            /**
+             * @brief Alloue au moins n éléments, count reçoit le nombre
+             * d'éléments que contient la projection.
+             */
+            pointer allocate_at_least(size_type n, size_type& count) {
+                if (n > this->max_size()) {
+                    throw std::bad_alloc();
+                }
+                std::size_t bytes = huge_page_blocks::mapped_size(n * sizeof(T));
+                pointer p = static_cast< pointer >(huge_page_blocks::allocate(bytes));
+                count = huge_page_blocks::is_mapped(n * sizeof(T)) ? bytes / sizeof(T) : n;
+                return p;
+            }
+
+            bool try_expand(pointer p, size_type old_n, size_type new_n) {
+                return new_n <= this->max_size() &&
+                    huge_page_blocks::try_expand(
+                        p, huge_page_blocks::mapped_size(old_n * sizeof(T)),
+                        huge_page_blocks::mapped_size(new_n * sizeof(T)));
+            }
+
+            /**
+             * @brief Déplace le bloc p vers au moins new_n éléments. Les octets
+             * sont repris tels quels : réservé aux types trivialement relogeables.
+             */
+            pointer reallocate(pointer p, size_type old_n, size_type new_n, size_type& count) {
+                if (new_n > this->max_size()) {
+                    throw std::bad_alloc();
+                }
+                std::size_t bytes = huge_page_blocks::mapped_size(new_n * sizeof(T));
+                pointer next = static_cast< pointer >(huge_page_blocks::reallocate(
+                    p, huge_page_blocks::mapped_size(old_n * sizeof(T)), bytes));
+                count = huge_page_blocks::is_mapped(new_n * sizeof(T)) ? bytes / sizeof(T) : new_n;
+                return next;
+            }
+
+            size_type max_size() const {
+                return std::numeric_limits< size_type >::max() / sizeof(T) / 2;
+            }
+
+#ifdef FT_CONTAINERS_CXX11
+            template < class U, class... Args >
+            void construct(U* p, Args&&... args) {
+                ::new (static_cast< void* >(p)) U(std::forward< Args >(args)...);
+            }
+
+            template < class U >
+            void destroy(U* p) {
+                p->~U();
+            }
+#else
+            void construct(pointer p, const_reference val) { new (p) T(val); }
+
+            void destroy(pointer p) { p->~T(); }
+#endif
+    };
+
+    template < class T, class U >
+    bool operator==(const huge_page_allocator< T >&, const huge_page_allocator< U >&) {
+        return true;
+    }
+
+    template < class T, class U >
+    bool operator!=(const huge_page_allocator< T >&, const huge_page_allocator< U >&) {
+        return false;
+    }
+
+    template < class T >
+    struct allocator_expansion< huge_page_allocator< T > >
+        : public allocator_expansion_base< huge_page_allocator< T > > {
+        typedef typename huge_page_allocator< T >::pointer pointer;
+        typedef typename huge_page_allocator< T >::size_type size_type;
+
+        static const bool can_reallocate = true;
+
+        static bool try_expand(huge_page_allocator< T >& alloc, pointer p, size_type old_n,
+                            size_type new_n) {
+            return alloc.try_expand(p, old_n, new_n);
+        }
+
+        static pointer allocate_at_least(huge_page_allocator< T >& alloc, size_type n,
+                                        size_type& count) {
+            return alloc.allocate_at_least(n, count);
+        }
+
+        static pointer reallocate(huge_page_allocator< T >& alloc, pointer p, size_type old_n,
+                                size_type new_n, size_type& count) {
+            return alloc.reallocate(p, old_n, new_n, count);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   huge_page_allocator_bench.cpp                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "huge_page_allocator.hpp"
+#include "vector.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+namespace {
+    const std::size_t ELEMENT_COUNT = std::size_t(1) << 26;
+
+    /**
+     * @brief push_back de ELEMENT_COUNT entiers de 8 octets : temps total,
+     * temps cumulé et pire durée des push_back qui font grandir le tampon,
+     * et pic de mémoire résidente au-delà de celle d'avant le remplissage.
+     */
+    template < class Vector >
+    void bench_growth(const char* name) {
+        bool peak_reset = bench::reset_peak_rss();
+        double base_mib = bench::status_mib("VmRSS");
+        double growth_ns = 0;
+        double worst_ns = 0;
+        std::size_t growths = 0;
+        double start = bench::now_ns();
+        {
+            Vector v;
+            for (std::size_t i = 0; i < ELEMENT_COUNT; ++i) {
+                if (v.size() == v.capacity()) {
+                    double grow_start = bench::now_ns();
+                    v.push_back(i);
+                    double elapsed = bench::now_ns() - grow_start;
+                    growth_ns += elapsed;
+                    worst_ns = elapsed > worst_ns ? elapsed : worst_ns;
+                    ++growths;
+                } else {
+                    v.push_back(i);
+                }
+            }
+            double total_ms = (bench::now_ns() - start) / 1e6;
+            double peak_mib = bench::status_mib("VmHWM") - base_mib;
+
+            std::cout << "\t " << name << ": " << total_ms << " ms, " << growths
+                    << " growths costing " << growth_ns / 1e6 << " ms (worst "
+                    << worst_ns / 1e6 << " ms), peak RSS +" << peak_mib << " MiB"
+                    << (peak_reset ? "" : " (process peak)") << " for "
+                    << v.size() * sizeof(unsigned long) / (1024.0 * 1024.0) << " MiB of data"
+                    << std::endl;
+        }
+    }
+}
+
+void bench_huge_page_allocator(void) {
+    std::cout << "Bench: huge_page_allocator, push_back of " << ELEMENT_COUNT
+            << " unsigned long" << std::endl;
+    bench_growth< ft::vector< unsigned long, ft::huge_page_allocator< unsigned long > > >(
+        "ft::vector, huge_page_allocator");
+    bench_growth< ft::vector< unsigned long > >("ft::vector, std::allocator");
+    bench_growth< std::vector< unsigned long > >("std::vector, std::allocator");
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   huge_page_allocator_test.cpp                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "huge_page_allocator.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <string>
+#ifdef FT_CONTAINERS_CXX11
+#include <memory>
+#endif
+
+#include "tracking_allocator.hpp"
+#include "vector.hpp"
+
+void test_huge_page_allocator(void) {
+    std::cout << "Test: huge_page_allocator" << std::endl;
+
+    typedef ft::vector< unsigned long, ft::huge_page_allocator< unsigned long > > big_vector;
+    big_vector values;
+    for (unsigned long i = 0; i < 1000000; ++i) {
+        values.push_back(i * 3);
+        assert(values.capacity() >= values.size());
+    }
+    for (unsigned long i = 0; i < values.size(); i += 997) {
+        assert(values[i] == i * 3);
+    }
+    assert(values.back() == 999999 * 3);
+
+    values.insert(values.begin() + 10, 300000, 7);
+    assert(values.size() == 1300000 && values[9] == 27 && values[10] == 7);
+    assert(values[300010] == 30 && values.back() == 999999 * 3);
+    values.erase(values.begin() + 10, values.begin() + 300010);
+    assert(values.size() == 1000000 && values[10] == 30);
+
+    values.reserve(3000000);
+    assert(values.capacity() >= 3000000 && values[999999] == 999999 * 3);
+    values.resize(1000);
+    values.shrink_to_fit();
+    assert(values.capacity() >= 1000 && values.capacity() < 1100 && values[999] == 999 * 3);
+
+    big_vector copy(values);
+    values = big_vector(200000, 5);
+    copy = values;
+    assert(copy.size() == 200000 && copy[199999] == 5);
+
+    ft::huge_page_allocator< int > alloc;
+    int* block = alloc.allocate(300000);
+    assert(reinterpret_cast< std::size_t >(block) % 4096 == 0);
+    block[0] = 1;
+    block[299999] = 2;
+    alloc.deallocate(block, 300000);
+    assert(!ft::huge_page_blocks::is_mapped(1000));
+
+    ft::vector< std::string, ft::huge_page_allocator< std::string > > strings;
+    for (int i = 0; i < 60000; ++i) {
+        strings.push_back(std::string(static_cast< size_t >(i % 50), 'h'));
+    }
+    strings.erase(strings.begin(), strings.begin() + 100);
+    assert(strings.size() == 59900 && strings[0].size() == 0 && strings[1].size() == 1);
+
+    typedef ft::tracking_allocator< ft::huge_page_allocator< double > > tracked;
+    ft::allocation_stats stats;
+    {
+        ft::vector< double, tracked > doubles((tracked(stats)));
+        for (int i = 0; i < 500000; ++i) {
+            doubles.push_back(i);
+        }
+        assert(stats.bytes_live == doubles.memory_footprint());
+    }
+    assert(stats.bytes_live == 0 && stats.allocations == stats.deallocations);
+
+#ifdef FT_CONTAINERS_CXX11
+    /* construct transmet ses arguments : les éléments non copiables passent */
+    typedef ft::huge_page_allocator< std::unique_ptr< int > > owner_allocator;
+    owner_allocator owner_alloc;
+    ft::vector< std::unique_ptr< int >, owner_allocator > owners(owner_alloc);
+    for (int i = 0; i < 300; ++i) {
+        owners.emplace_back(new int(i));
+    }
+    owners.insert(owners.begin() + 1, std::unique_ptr< int >(new int(-1)));
+    assert(owners.size() == 301 && *owners[1] == -1 && *owners[300] == 299);
+#endif
+}
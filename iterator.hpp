@@ -14,6 +14,7 @@
 #define _ITERATOR_HPP_
 
 #include <iostream>
+#include <iterator>
 #include <cstddef>
 
 namespace ft {
@@ -170,6 +171,58 @@ namespace ft {
         typedef const T & reference;
     };
 
+    /*
+    Associe à une balise de catégorie son équivalent ft::, afin que les
+    itérateurs de la bibliothèque standard (std::istream_iterator,
+    std::vector::iterator...) soient répartis sur les mêmes surcharges
+    que les itérateurs ft::.
+
+    @tparam Tag balise de catégorie ft:: ou std::
+    */
+
+    template < class Tag >
+    struct normalize_category {
+        typedef Tag type;
+    };
+
+    template <>
+    struct normalize_category< std::input_iterator_tag > {
+        typedef input_iterator_tag type;
+    };
+
+    template <>
+    struct normalize_category< std::output_iterator_tag > {
+        typedef output_iterator_tag type;
+    };
+
+    template <>
+    struct normalize_category< std::forward_iterator_tag > {
+        typedef forward_iterator_tag type;
+    };
+
+    template <>
+    struct normalize_category< std::bidirectional_iterator_tag > {
+        typedef bidirectional_iterator_tag type;
+    };
+
+    template <>
+    struct normalize_category< std::random_access_iterator_tag > {
+        typedef random_access_iterator_tag type;
+    };
+
+    /*
+    Balise de catégorie ft:: d'un type d'itérateur, utilisée pour le
+    dispatch par balise : `typename ft::iterator_category_of< It >::type()`.
+
+    @tparam Iterator type d'itérateur
+    */
+
+    template < class Iterator >
+    struct iterator_category_of {
+        typedef typename normalize_category<
+            typename iterator_traits< Iterator >::iterator_category >::type type;
+    };
+
     /*
     Cette classe inverse le sens dans lequel un itérateur
     bidirectionnel à accès aléatoire parcourt une intervalle
@@ -229,7 +282,7 @@ namespace ft {
             l'itération est conservée.
             */
             template < class Iter >
-            reverse_iterator(const reverse_iterator< Iter >& rev_it) : current(rev_it.base()){};
+            reverse_iterator(const reverse_iterator< Iter >& rev_it) : current(rev_it.base()){}
 
             virtual ~reverse_iterator(){};
 
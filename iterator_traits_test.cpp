@@ -12,6 +12,7 @@
 
 #include <cassert>
 #include <iostream>
+#include <typeinfo>
 
 #include "iterator.hpp"
 
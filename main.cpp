@@ -12,7 +12,6 @@
 
 #include <iostream>
 #include <iterator>
-#include <type_traits>
 #include <vector>
 
 #include "iterator.hpp"
@@ -23,13 +22,31 @@
 int main(void) {
     std::cout << "Test: ft_containers" << std::endl;
 
-    // test_iterator_traits();
-    // test_reverse_iterator();
-    // test_algorithm();
-    // test_utility();
-    // test_random_access_iterator();
+    test_iterator_traits();
+    test_reverse_iterator();
+    test_algorithm();
+    test_utility();
+    test_random_access_iterator();
 
     test_vector();
+    test_small_vector();
+    test_pool_allocator();
+    test_arena();
+    test_tracking_allocator();
+    test_malloc_allocator();
+    test_huge_page_allocator();
+    test_mapped_vector();
+    test_snapshot();
+    test_async_reader();
+    test_parallel();
+    test_trace();
+    test_map();
+    test_btree_map();
+    test_unordered_flat_map();
+    test_flat_map();
+    test_flat_set();
+    test_stack();
+    test_queue();
 
     return 0;
 }
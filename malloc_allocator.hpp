@@ -0,0 +1,191 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   malloc_allocator.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _MALLOC_ALLOCATOR_HPP_
+#define _MALLOC_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+#if defined(__GLIBC__) || defined(__linux__)
+#include <malloc.h>
+#define FT_MALLOC_USABLE_SIZE(p) malloc_usable_size(p)
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#define FT_MALLOC_USABLE_SIZE(p) malloc_size(p)
+#endif
+
+#include "memory.hpp"
+#include "util.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Taille réellement utilisable du bloc p obtenu par malloc pour
+     * requested octets. Sans moyen de la connaître, renvoie requested.
+     */
+    inline std::size_t malloc_usable_bytes(void* p, std::size_t requested) {
+#ifdef FT_MALLOC_USABLE_SIZE
+        std::size_t usable = FT_MALLOC_USABLE_SIZE(p);
+        return usable > requested ? usable : requested;
+#else
+        (void)p;
+        return requested;
+#endif
+    }
+
+    /**
+     * @brief Allocateur sans état reposant sur malloc / free. Avec
+     * ft::vector, la capacité suit la taille réelle des blocs rendus par
+     * malloc (malloc_usable_size), une croissance qui tient dans le bloc se
+     * fait sans copie, et les éléments trivialement relogeables sont
+     * réalloués par realloc, qui peut agrandir le bloc sur place.
+     *
+     * @tparam T Type des éléments alloués.
+     */
+    template < class T >
+    class malloc_allocator {
+        public:
+            typedef T value_type;
+            typedef T* pointer;
+            typedef const T* const_pointer;
+            typedef T& reference;
+            typedef const T& const_reference;
+            typedef std::size_t size_type;
+            typedef std::ptrdiff_t difference_type;
+
+            template < class U >
+            struct rebind {
+                typedef malloc_allocator< U > other;
+            };
+
+            malloc_allocator() {}
+
+            malloc_allocator(const malloc_allocator&) {}
+
+            template < class U >
+            malloc_allocator(const malloc_allocator< U >&) {}
+
+            ~malloc_allocator() {}
+
+            malloc_allocator& operator=(const malloc_allocator&) { return *this; }
+
+            pointer address(reference x) const { return &x; }
+
+            const_pointer address(const_reference x) const { return &x; }
+
+            pointer allocate(size_type n, const void* = 0) {
+                if (n > this->max_size()) {
+                    throw std::bad_alloc();
+                }
+                void* p = std::malloc(n ? n * sizeof(T) : 1);
+                if (!p) {
+                    throw std::bad_alloc();
+                }
+                return static_cast< pointer >(p);
+            }
+
+            void deallocate(pointer p, size_type) { std::free(p); }
+
+            /**
+             * @brief Alloue au moins n éléments, count reçoit le nombre
+             * d'éléments que contient réellement le bloc.
+             */
+            pointer allocate_at_least(size_type n, size_type& count) {
+                pointer p = this->allocate(n);
+                count = ft::malloc_usable_bytes(p, n * sizeof(T)) / sizeof(T);
+                return p;
+            }
+
+            /**
+             * @brief Vrai si le bloc p contient déjà new_n éléments.
+             */
+            bool try_expand(pointer p, size_type, size_type new_n) {
+                return new_n <= this->max_size() &&
+                    ft::malloc_usable_bytes(p, 0) >= new_n * sizeof(T);
+            }
+
+            /**
+             * @brief realloc du bloc p vers au moins new_n éléments. Les octets
+             * sont copiés tels quels : réservé aux types trivialement relogeables.
+             */
+            pointer reallocate(pointer p, size_type, size_type new_n, size_type& count) {
+                if (new_n > this->max_size()) {
+                    throw std::bad_alloc();
+                }
+                void* next = std::realloc(p, new_n ? new_n * sizeof(T) : 1);
+                if (!next) {
+                    throw std::bad_alloc();
+                }
+                count = ft::malloc_usable_bytes(next, new_n * sizeof(T)) / sizeof(T);
+                return static_cast< pointer >(next);
+            }
+
+            size_type max_size() const {
+                return std::numeric_limits< size_type >::max() / sizeof(T);
+            }
+
+#ifdef FT_CONTAINERS_CXX11
+            template < class U, class... Args >
+            void construct(U* p, Args&&... args) {
+                ::new (static_cast< void* >(p)) U(std::forward< Args >(args)...);
+            }
+
+            template < class U >
+            void destroy(U* p) {
+                p->~U();
+            }
+#else
+            void construct(pointer p, const_reference val) { new (p) T(val); }
+
+            void destroy(pointer p) { p->~T(); }
+#endif
+    };
+
+    template < class T, class U >
+    bool operator==(const malloc_allocator< T >&, const malloc_allocator< U >&) {
+        return true;
+    }
+
+    template < class T, class U >
+    bool operator!=(const malloc_allocator< T >&, const malloc_allocator< U >&) {
+        return false;
+    }
+
+    template < class T >
+    struct allocator_expansion< malloc_allocator< T > >
+        : public allocator_expansion_base< malloc_allocator< T > > {
+        typedef typename malloc_allocator< T >::pointer pointer;
+        typedef typename malloc_allocator< T >::size_type size_type;
+
+        static const bool can_reallocate = true;
+
+        static bool try_expand(malloc_allocator< T >& alloc, pointer p, size_type old_n,
+                            size_type new_n) {
+            return alloc.try_expand(p, old_n, new_n);
+        }
+
+        static pointer allocate_at_least(malloc_allocator< T >& alloc, size_type n,
+                                        size_type& count) {
+            return alloc.allocate_at_least(n, count);
+        }
+
+        static pointer reallocate(malloc_allocator< T >& alloc, pointer p, size_type old_n,
+                                size_type new_n, size_type& count) {
+            return alloc.reallocate(p, old_n, new_n, count);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   malloc_allocator_test.cpp                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "malloc_allocator.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <string>
+#ifdef FT_CONTAINERS_CXX11
+#include <memory>
+#endif
+#include <vector>
+
+#include "tracking_allocator.hpp"
+#include "vector.hpp"
+
+void test_malloc_allocator(void) {
+    std::cout << "Test: malloc_allocator" << std::endl;
+
+    ft::vector< int, ft::malloc_allocator< int > > ints;
+    std::vector< int > std_ints;
+    for (int i = 0; i < 10000; ++i) {
+        ints.push_back(i);
+        std_ints.push_back(i);
+        assert(ints.capacity() >= ints.size());
+    }
+    ints.insert(ints.begin() + 5, 1000, -1);
+    std_ints.insert(std_ints.begin() + 5, 1000, -1);
+    ints.erase(ints.begin() + 100, ints.begin() + 600);
+    std_ints.erase(std_ints.begin() + 100, std_ints.begin() + 600);
+    assert(ints.size() == std_ints.size());
+    for (size_t i = 0; i < std_ints.size(); ++i) {
+        assert(ints[i] == std_ints[i]);
+    }
+
+    ints.reserve(50000);
+    assert(ints.capacity() >= 50000 && ints.back() == 9999);
+    ints.resize(20);
+    ints.shrink_to_fit();
+    assert(ints.size() == 20 && ints.capacity() >= 20 && ints.capacity() < 40);
+    assert(ints[19] == std_ints[19]);
+
+    ft::malloc_allocator< int > alloc;
+    ft::malloc_allocator< int >::size_type count = 0;
+    int* block = alloc.allocate_at_least(3, count);
+    assert(count >= 3);
+    assert(alloc.try_expand(block, 3, count));
+    block = alloc.reallocate(block, count, 1000, count);
+    assert(count >= 1000);
+    alloc.deallocate(block, count);
+
+    ft::vector< std::string, ft::malloc_allocator< std::string > > strings;
+    for (int i = 0; i < 500; ++i) {
+        strings.push_back(std::string(static_cast< size_t >(i % 40), 'm'));
+    }
+    strings.erase(strings.begin(), strings.begin() + 250);
+    strings.shrink_to_fit();
+    assert(strings.size() == 250 && strings[0].size() == 250 % 40);
+
+    typedef ft::tracking_allocator< ft::malloc_allocator< long > > tracked;
+    ft::allocation_stats stats;
+    {
+        ft::vector< long, tracked > longs((tracked(stats)));
+        for (long i = 0; i < 5000; ++i) {
+            longs.push_back(i);
+            assert(stats.bytes_live == longs.memory_footprint());
+        }
+        longs.resize(10);
+        longs.shrink_to_fit();
+        assert(stats.bytes_live == longs.memory_footprint() && longs[9] == 9);
+    }
+    assert(stats.bytes_live == 0 && stats.allocations == stats.deallocations);
+
+#ifdef FT_CONTAINERS_CXX11
+    /* construct transmet ses arguments : les éléments non copiables passent */
+    typedef ft::malloc_allocator< std::unique_ptr< int > > owner_allocator;
+    owner_allocator owner_alloc;
+    ft::vector< std::unique_ptr< int >, owner_allocator > owners(owner_alloc);
+    for (int i = 0; i < 300; ++i) {
+        owners.emplace_back(new int(i));
+    }
+    owners.insert(owners.begin() + 1, std::unique_ptr< int >(new int(-1)));
+    assert(owners.size() == 301 && *owners[1] == -1 && *owners[300] == 299);
+#endif
+}
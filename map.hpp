@@ -0,0 +1,606 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map.hpp                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _MAP_HPP_
+#define _MAP_HPP_
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include "algorithm.hpp"
+#include "bidirectional_iterator.hpp"
+#include "iterator.hpp"
+#include "rb_tree.hpp"
+#include "slab.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft {
+    /**
+     * @brief Conteneur associatif ordonné de paires clé / valeur à clés
+     * uniques, implémenté par un arbre rouge-noir.
+     * Les noeuds sont pris dans une ft::node_slab plutôt qu'alloués un à un,
+     * et la construction à partir d'un intervalle trié se fait en O(n).
+     *
+     * @tparam Key Type des clés.
+     * @tparam T Type des valeurs associées.
+     * @tparam Compare Ordre strict sur les clés, par défaut `std::less<Key>`.
+     * @tparam Alloc Allocateur de `pair<const Key, T>`, relié aux noeuds.
+     */
+    template < class Key, class T, class Compare = std::less< Key >,
+            class Alloc = std::allocator< ft::pair< const Key, T > > >
+    class map {
+        public:
+            /* Le premier paramètre du template (Key) */
+            typedef Key key_type;
+            /* Le deuxième paramètre du template (T) */
+            typedef T mapped_type;
+            /* pair<const key_type, mapped_type> */
+            typedef ft::pair< const key_type, mapped_type > value_type;
+            /* Le troisième paramètre du template (Compare) */
+            typedef Compare key_compare;
+            /* Le quatrième paramètre du template (Alloc) */
+            typedef Alloc allocator_type;
+            typedef typename allocator_type::reference reference;
+            typedef typename allocator_type::const_reference const_reference;
+            typedef typename allocator_type::pointer pointer;
+            typedef typename allocator_type::const_pointer const_pointer;
+
+            /* un itérateur bidirectionnel sur value_type */
+            typedef ft::bidirectional_iterator< value_type > iterator;
+            /* un itérateur bidirectionnel sur const value_type */
+            typedef ft::bidirectional_iterator< const value_type > const_iterator;
+            typedef ft::reverse_iterator< iterator > reverse_iterator;
+            typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+
+            typedef typename ft::iterator_traits< iterator >::difference_type difference_type;
+            typedef typename allocator_type::size_type size_type;
+
+            /**
+             * @brief Compare deux value_type selon leurs clés.
+             */
+            class value_compare {
+                    friend class map;
+
+                protected:
+                    Compare comp;
+
+                    value_compare(Compare c) : comp(c) {}
+
+                public:
+                    typedef bool result_type;
+                    typedef value_type first_argument_type;
+                    typedef value_type second_argument_type;
+
+                    bool operator()(const value_type& x, const value_type& y) const {
+                        return comp(x.first, y.first);
+                    }
+            };
+
+        private:
+            typedef ft::rb_node< value_type > node_type;
+            typedef ft::node_slab< node_type, allocator_type > slab_type;
+
+            key_compare _comp;
+            allocator_type _alloc;
+            rb_node_base _header;
+            size_type _size;
+            slab_type _slab;
+
+        public:
+            /**
+             * @brief constructeur de conteneur vide (constructeur par défaut)
+             */
+            explicit map(const key_compare& comp = key_compare(),
+                        const allocator_type& alloc = allocator_type())
+                : _comp(comp), _alloc(alloc), _size(0), _slab(alloc) {
+                ft::rb_tree_reset(this->_header);
+            }
+
+            /**
+             * @brief constructeur d'intervalle
+             * Si [first, last) est trié par clés strictement croissantes,
+             * l'arbre est construit équilibré en O(n) ; sinon les éléments à
+             * partir du premier désordre sont insérés un par un.
+             */
+            template < class InputIterator >
+            map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+                const allocator_type& alloc = allocator_type())
+                : _comp(comp), _alloc(alloc), _size(0), _slab(alloc) {
+                ft::rb_tree_reset(this->_header);
+                this->_range_init(first, last);
+            }
+
+            /**
+             * @brief constructeur par copie
+             * Recopie l'arbre de x noeud par noeud, couleurs comprises, en O(n).
+             */
+            map(const map& x)
+                : _comp(x._comp), _alloc(x._alloc), _size(0), _slab(x._alloc) {
+                ft::rb_tree_reset(this->_header);
+                this->_copy_from(x);
+            }
+
+            map& operator=(const map& x) {
+                if (this != &x) {
+                    this->clear();
+                    this->_comp = x._comp;
+                    this->_copy_from(x);
+                }
+                return *this;
+            }
+
+            ~map() { this->clear(); }
+
+            iterator begin() { return iterator(this->_header.left); }
+
+            const_iterator begin() const { return const_iterator(this->_header.left); }
+
+            iterator end() { return iterator(&this->_header); }
+
+            const_iterator end() const {
+                return const_iterator(const_cast< rb_node_base* >(&this->_header));
+            }
+
+            reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+            const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+            reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+            const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+            bool empty() const { return this->_size == 0; }
+
+            size_type size() const { return this->_size; }
+
+            size_type max_size() const { return this->_slab.get_allocator().max_size(); }
+
+            /**
+             * @brief Accès à l'élément de clé k, inséré avec une valeur par
+             * défaut s'il n'existe pas.
+             */
+            mapped_type& operator[](const key_type& k) {
+                iterator it = this->lower_bound(k);
+                if (it == this->end() || this->_comp(k, it->first)) {
+                    it = this->insert(it, value_type(k, mapped_type()));
+                }
+                return it->second;
+            }
+
+            /**
+             * @brief Accès à l'élément de clé k, std::out_of_range s'il n'existe pas.
+             */
+            mapped_type& at(const key_type& k) {
+                iterator it = this->find(k);
+                if (it == this->end()) {
+                    throw std::out_of_range("ft::map");
+                }
+                return it->second;
+            }
+
+            const mapped_type& at(const key_type& k) const {
+                const_iterator it = this->find(k);
+                if (it == this->end()) {
+                    throw std::out_of_range("ft::map");
+                }
+                return it->second;
+            }
+
+            /**
+             * @brief Insère val si sa clé est absente.
+             * Renvoie l'élément de même clé et true s'il a été inséré.
+             */
+            ft::pair< iterator, bool > insert(const value_type& val) {
+                rb_node_base* parent = &this->_header;
+                rb_node_base* x = this->_header.parent;
+                bool go_left = true;
+                while (x) {
+                    parent = x;
+                    go_left = this->_comp(val.first, _key(x));
+                    x = go_left ? x->left : x->right;
+                }
+                iterator j(parent);
+                if (go_left) {
+                    if (j == this->begin()) {
+                        return ft::make_pair(this->_insert_at(true, parent, val), true);
+                    }
+                    --j;
+                }
+                if (this->_comp(_key(j.base()), val.first)) {
+                    return ft::make_pair(this->_insert_at(go_left, parent, val), true);
+                }
+                return ft::make_pair(j, false);
+            }
+
+            /**
+             * @brief Insère val en partant de position : si val se place juste
+             * avant ou juste après position, l'insertion se fait sans recherche,
+             * en temps constant amorti.
+             */
+            iterator insert(iterator position, const value_type& val) {
+                rb_node_base* pos = position.base();
+                if (pos == &this->_header) {
+                    if (this->_size > 0 && this->_comp(_key(this->_header.right), val.first)) {
+                        return this->_insert_at(false, this->_header.right, val);
+                    }
+                    return this->insert(val).first;
+                }
+                if (this->_comp(val.first, _key(pos))) {
+                    if (pos == this->_header.left) {
+                        return this->_insert_at(true, pos, val);
+                    }
+                    rb_node_base* before = ft::rb_tree_decrement(pos);
+                    if (!this->_comp(_key(before), val.first)) {
+                        return this->insert(val).first;
+                    }
+                    if (!before->right) {
+                        return this->_insert_at(false, before, val);
+                    }
+                    return this->_insert_at(true, pos, val);
+                }
+                if (this->_comp(_key(pos), val.first)) {
+                    if (pos == this->_header.right) {
+                        return this->_insert_at(false, pos, val);
+                    }
+                    rb_node_base* after = ft::rb_tree_increment(pos);
+                    if (!this->_comp(val.first, _key(after))) {
+                        return this->insert(val).first;
+                    }
+                    if (!pos->right) {
+                        return this->_insert_at(false, pos, val);
+                    }
+                    return this->_insert_at(true, after, val);
+                }
+                return position;
+            }
+
+            /**
+             * @brief Insère les éléments de [first, last), en O(n) dans un
+             * conteneur vide si l'intervalle est trié.
+             */
+            template < class InputIterator >
+            void insert(InputIterator first, InputIterator last) {
+                if (this->empty()) {
+                    this->_range_init(first, last);
+                    return;
+                }
+                for (; first != last; ++first) {
+                    this->insert(this->end(), *first);
+                }
+            }
+
+            void erase(iterator position) {
+                this->_destroy_node(ft::rb_tree_rebalance_for_erase(position.base(), this->_header));
+                --this->_size;
+            }
+
+            size_type erase(const key_type& k) {
+                ft::pair< iterator, iterator > range = this->equal_range(k);
+                size_type prev_size = this->_size;
+                this->erase(range.first, range.second);
+                return prev_size - this->_size;
+            }
+
+            void erase(iterator first, iterator last) {
+                if (first == this->begin() && last == this->end()) {
+                    this->clear();
+                    return;
+                }
+                while (first != last) {
+                    this->erase(first++);
+                }
+            }
+
+            /**
+             * @brief Echange de contenu en temps constant, allocateurs compris
+             */
+            void swap(map& x) {
+                rb_node_base* root = this->_header.parent;
+                rb_node_base* leftmost = this->_header.left;
+                rb_node_base* rightmost = this->_header.right;
+                _adopt(this->_header, x._header.parent, x._header.left, x._header.right);
+                _adopt(x._header, root, leftmost, rightmost);
+                ft::swap(this->_size, x._size);
+                ft::swap(this->_comp, x._comp);
+                ft::swap(this->_alloc, x._alloc);
+                this->_slab.swap(x._slab);
+            }
+
+            void clear() {
+                this->_destroy_subtree(this->_header.parent);
+                ft::rb_tree_reset(this->_header);
+                this->_size = 0;
+                this->_slab.release();
+            }
+
+            key_compare key_comp() const { return this->_comp; }
+
+            value_compare value_comp() const { return value_compare(this->_comp); }
+
+            iterator find(const key_type& k) {
+                iterator it = this->lower_bound(k);
+                return (it == this->end() || this->_comp(k, it->first)) ? this->end() : it;
+            }
+
+            const_iterator find(const key_type& k) const {
+                const_iterator it = this->lower_bound(k);
+                return (it == this->end() || this->_comp(k, it->first)) ? this->end() : it;
+            }
+
+            size_type count(const key_type& k) const {
+                return this->find(k) == this->end() ? 0 : 1;
+            }
+
+            /**
+             * @brief Premier élément dont la clé n'est pas inférieure à k.
+             */
+            iterator lower_bound(const key_type& k) { return iterator(this->_lower_bound(k)); }
+
+            const_iterator lower_bound(const key_type& k) const {
+                return const_iterator(this->_lower_bound(k));
+            }
+
+            /**
+             * @brief Premier élément dont la clé est supérieure à k.
+             */
+            iterator upper_bound(const key_type& k) { return iterator(this->_upper_bound(k)); }
+
+            const_iterator upper_bound(const key_type& k) const {
+                return const_iterator(this->_upper_bound(k));
+            }
+
+            ft::pair< iterator, iterator > equal_range(const key_type& k) {
+                return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+            }
+
+            ft::pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+                return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+            }
+
+            allocator_type get_allocator() const { return this->_alloc; }
+
+        private:
+            static const key_type& _key(const rb_node_base* x) {
+                return static_cast< const node_type* >(x)->value.first;
+            }
+
+            /**
+             * @brief Rattache un arbre (racine, plus petit et plus grand noeud)
+             * au header to, ou le réinitialise si root est nul.
+             */
+            static void _adopt(rb_node_base& to, rb_node_base* root, rb_node_base* leftmost,
+                            rb_node_base* rightmost) {
+                if (!root) {
+                    ft::rb_tree_reset(to);
+                    return;
+                }
+                to.parent = root;
+                to.left = leftmost;
+                to.right = rightmost;
+                root->parent = &to;
+            }
+
+            rb_node_base* _lower_bound(const key_type& k) const {
+                rb_node_base* y = const_cast< rb_node_base* >(&this->_header);
+                rb_node_base* x = this->_header.parent;
+                while (x) {
+                    if (!this->_comp(_key(x), k)) {
+                        y = x;
+                        x = x->left;
+                    } else {
+                        x = x->right;
+                    }
+                }
+                return y;
+            }
+
+            rb_node_base* _upper_bound(const key_type& k) const {
+                rb_node_base* y = const_cast< rb_node_base* >(&this->_header);
+                rb_node_base* x = this->_header.parent;
+                while (x) {
+                    if (this->_comp(k, _key(x))) {
+                        y = x;
+                        x = x->left;
+                    } else {
+                        x = x->right;
+                    }
+                }
+                return y;
+            }
+
+            node_type* _create_node(const value_type& val) {
+                node_type* node = this->_slab.allocate();
+                try {
+                    this->_alloc.construct(&node->value, val);
+                }
+                catch (...) {
+                    this->_slab.deallocate(node);
+                    throw;
+                }
+                return node;
+            }
+
+            void _destroy_node(rb_node_base* x) {
+                node_type* node = static_cast< node_type* >(x);
+                this->_alloc.destroy(&node->value);
+                this->_slab.deallocate(node);
+            }
+
+            void _destroy_subtree(rb_node_base* x) {
+                while (x) {
+                    this->_destroy_subtree(x->right);
+                    rb_node_base* left = x->left;
+                    this->_destroy_node(x);
+                    x = left;
+                }
+            }
+
+            iterator _insert_at(bool insert_left, rb_node_base* parent, const value_type& val) {
+                node_type* node = this->_create_node(val);
+                ft::rb_tree_insert_and_rebalance(insert_left || parent == &this->_header, node,
+                                                parent, this->_header);
+                ++this->_size;
+                return iterator(node);
+            }
+
+            /**
+             * @brief Recopie récursivement le sous-arbre x ; en cas d'exception
+             * la partie déjà copiée est détruite.
+             */
+            rb_node_base* _clone(const rb_node_base* x, rb_node_base* parent) {
+                rb_node_base* top = this->_create_node(static_cast< const node_type* >(x)->value);
+                top->color = x->color;
+                top->parent = parent;
+                top->left = u_nullptr;
+                top->right = u_nullptr;
+                try {
+                    if (x->left) {
+                        top->left = this->_clone(x->left, top);
+                    }
+                    if (x->right) {
+                        top->right = this->_clone(x->right, top);
+                    }
+                }
+                catch (...) {
+                    this->_destroy_subtree(top);
+                    throw;
+                }
+                return top;
+            }
+
+            void _copy_from(const map& x) {
+                if (!x._header.parent) {
+                    return;
+                }
+                rb_node_base* root = this->_clone(x._header.parent, &this->_header);
+                _adopt(this->_header, root, rb_node_base::minimum(root),
+                    rb_node_base::maximum(root));
+                this->_size = x._size;
+            }
+
+            /**
+             * @brief Remplit un conteneur vide. Les noeuds sont créés tant que
+             * les clés sont strictement croissantes puis liés en un arbre
+             * équilibré en O(n) ; le reste de l'intervalle, à partir du premier
+             * désordre, est inséré élément par élément.
+             */
+            template < class InputIterator >
+            void _range_init(InputIterator first, InputIterator last) {
+                ft::vector< rb_node_base* > nodes;
+                try {
+                    for (; first != last; ++first) {
+                        if (!nodes.empty() && !this->_comp(_key(nodes.back()), (*first).first)) {
+                            break;
+                        }
+                        nodes.push_back(u_nullptr);
+                        nodes.back() = this->_create_node(*first);
+                    }
+                }
+                catch (...) {
+                    for (size_type i = 0; i < nodes.size(); ++i) {
+                        if (nodes[i]) {
+                            this->_destroy_node(nodes[i]);
+                        }
+                    }
+                    throw;
+                }
+                this->_link_sorted(nodes);
+                for (; first != last; ++first) {
+                    this->insert(this->end(), *first);
+                }
+            }
+
+            /**
+             * @brief Lie des noeuds triés en un arbre de hauteur minimale.
+             * Les niveaux complets sont noirs et le dernier niveau, incomplet,
+             * est rouge, ce qui respecte les propriétés rouge-noir.
+             */
+            void _link_sorted(const ft::vector< rb_node_base* >& nodes) {
+                size_type n = nodes.size();
+                if (n == 0) {
+                    return;
+                }
+                size_type full_levels = 0;
+                while ((static_cast< size_type >(2) << full_levels) - 1 <= n) {
+                    ++full_levels;
+                }
+                rb_node_base* root =
+                    this->_link_range(nodes, 0, n, 0, full_levels, &this->_header);
+                _adopt(this->_header, root, nodes[0], nodes[n - 1]);
+                this->_size = n;
+            }
+
+            rb_node_base* _link_range(const ft::vector< rb_node_base* >& nodes, size_type lo,
+                                    size_type hi, size_type depth, size_type full_levels,
+                                    rb_node_base* parent) {
+                if (lo == hi) {
+                    return u_nullptr;
+                }
+                size_type mid = lo + (hi - lo) / 2;
+                rb_node_base* x = nodes[mid];
+                x->parent = parent;
+                x->color = (depth >= full_levels) ? RB_RED : RB_BLACK;
+                x->left = this->_link_range(nodes, lo, mid, depth + 1, full_levels, x);
+                x->right = this->_link_range(nodes, mid + 1, hi, depth + 1, full_levels, x);
+                return x;
+            }
+    };
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator==(const map< Key, T, Compare, Alloc >& lhs,
+                    const map< Key, T, Compare, Alloc >& rhs) {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator!=(const map< Key, T, Compare, Alloc >& lhs,
+                    const map< Key, T, Compare, Alloc >& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator<(const map< Key, T, Compare, Alloc >& lhs,
+                const map< Key, T, Compare, Alloc >& rhs) {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator<=(const map< Key, T, Compare, Alloc >& lhs,
+                    const map< Key, T, Compare, Alloc >& rhs) {
+        return !(rhs < lhs);
+    }
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator>(const map< Key, T, Compare, Alloc >& lhs,
+                const map< Key, T, Compare, Alloc >& rhs) {
+        return rhs < lhs;
+    }
+
+    template < class Key, class T, class Compare, class Alloc >
+    bool operator>=(const map< Key, T, Compare, Alloc >& lhs,
+                    const map< Key, T, Compare, Alloc >& rhs) {
+        return !(lhs < rhs);
+    }
+
+    /**
+     * @brief Échanger le contenu de deux map
+     */
+    template < class Key, class T, class Compare, class Alloc >
+    void swap(map< Key, T, Compare, Alloc >& x, map< Key, T, Compare, Alloc >& y) {
+        x.swap(y);
+    }
+}
+
+#endif
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_bench.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "map.hpp"
+
+#include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "bench.hpp"
+
+namespace {
+    /* Nombre maximal de recherches chronométrées par taille */
+    const std::size_t MAX_LOOKUPS = 1000000;
+
+    double ms_since(double start) { return (bench::now_ns() - start) / 1e6; }
+
+    /**
+     * @brief Insertions aléatoires, recherches réussies, parcours complet,
+     * construction depuis un intervalle trié puis suppression de toutes les
+     * clés, avec les mêmes clés pour ft::map et std::map.
+     */
+    template < class Map, class Pair >
+    void bench_map_size(const char* name, std::size_t n) {
+        typedef typename Map::iterator iterator;
+
+        std::vector< long > keys(n);
+        bench::lcg rng(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            keys[i] = static_cast< long >(rng.next(n * 4));
+        }
+
+        Map m;
+        double start = bench::now_ns();
+        for (std::size_t i = 0; i < n; ++i) {
+            m.insert(Pair(keys[i], static_cast< long >(i)));
+        }
+        double insert_ms = ms_since(start);
+
+        std::size_t lookups = n < MAX_LOOKUPS ? n : MAX_LOOKUPS;
+        long found = 0;
+        start = bench::now_ns();
+        for (std::size_t i = 0; i < lookups; ++i) {
+            found += (m.find(keys[rng.next(n)]) != m.end());
+        }
+        double find_ms = ms_since(start);
+
+        long sum = 0;
+        start = bench::now_ns();
+        for (iterator it = m.begin(); it != m.end(); ++it) {
+            sum += it->second;
+        }
+        double iterate_ms = ms_since(start);
+
+        std::vector< Pair > sorted;
+        sorted.reserve(m.size());
+        for (iterator it = m.begin(); it != m.end(); ++it) {
+            sorted.push_back(*it);
+        }
+        start = bench::now_ns();
+        {
+            Map built(sorted.begin(), sorted.end());
+            sum += static_cast< long >(built.size());
+        }
+        double build_ms = ms_since(start);
+
+        start = bench::now_ns();
+        for (std::size_t i = 0; i < n; ++i) {
+            m.erase(keys[i]);
+        }
+        double erase_ms = ms_since(start);
+
+        std::cout << "\t " << name << " " << n << " keys: insert " << insert_ms << " ms, find "
+                << (find_ms * 1e6 / lookups) << " ns, iterate " << iterate_ms
+                << " ms, sorted build " << build_ms << " ms, erase " << erase_ms << " ms"
+                << (found + sum == -1 ? " " : "") << std::endl;
+    }
+}
+
+void bench_map(void) {
+    typedef ft::map< long, long > ft_map;
+    typedef std::map< long, long > std_map;
+
+    std::cout << "Bench: map vs std::map" << std::endl;
+    for (std::size_t n = 1000; n <= 10000000; n *= 10) {
+        bench_map_size< ft_map, ft::pair< const long, long > >("ft::map", n);
+        bench_map_size< std_map, std::pair< const long, long > >("std::map", n);
+    }
+}
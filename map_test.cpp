@@ -0,0 +1,195 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_test.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "arena.hpp"
+#include "map.hpp"
+
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    template < class Map >
+    bool is_valid_tree(const Map& m) {
+        const ft::rb_node_base* root = m.begin().base();
+        while (root->parent && root->parent->parent != root) {
+            root = root->parent;
+        }
+        if (m.empty()) {
+            return true;
+        }
+        return root->color == ft::RB_BLACK && ft::rb_tree_black_height(root) > 0;
+    }
+
+    template < class Map, class StdMap >
+    bool same_content(const Map& ft_map, const StdMap& std_map) {
+        if (ft_map.size() != std_map.size()) {
+            return false;
+        }
+        typename Map::const_iterator ft_it = ft_map.begin();
+        typename StdMap::const_iterator std_it = std_map.begin();
+        for (; std_it != std_map.end(); ++ft_it, ++std_it) {
+            if (ft_it->first != std_it->first || ft_it->second != std_it->second) {
+                return false;
+            }
+        }
+        return ft_it == ft_map.end();
+    }
+}
+
+void test_map_tree(void) {
+    std::cout << "\t red-black tree" << std::endl;
+
+    ft::map< int, int > ft_map;
+    std::map< int, int > std_map;
+    unsigned long state = 12345;
+    for (int i = 0; i < 5000; ++i) {
+        state = state * 6364136223846793005UL + 1442695040888963407UL;
+        int key = static_cast< int >((state >> 33) % 2000);
+        if (i % 3 == 2) {
+            assert(ft_map.erase(key) == std_map.erase(key));
+        } else {
+            ft_map.insert(ft::make_pair(key, i));
+            std_map.insert(std::make_pair(key, i));
+        }
+        if (i % 500 == 0) {
+            assert(is_valid_tree(ft_map));
+        }
+    }
+    assert(is_valid_tree(ft_map) && same_content(ft_map, std_map));
+
+    ft::map< int, int >::iterator it = ft_map.end();
+    std::map< int, int >::iterator std_it = std_map.end();
+    while (std_it != std_map.begin()) {
+        --it;
+        --std_it;
+        assert(it->first == std_it->first);
+    }
+    assert(it == ft_map.begin());
+    assert(ft_map.rbegin()->first == std_map.rbegin()->first);
+
+    ft::map< int, int >::const_iterator lower = ft_map.lower_bound(1000);
+    assert(lower->first == std_map.lower_bound(1000)->first);
+    assert(ft_map.upper_bound(1999) == ft_map.end());
+    assert(ft_map.count(lower->first) == 1 && ft_map.find(-1) == ft_map.end());
+
+    ft_map.erase(ft_map.begin(), ft_map.find(lower->first));
+    std_map.erase(std_map.begin(), std_map.find(lower->first));
+    assert(is_valid_tree(ft_map) && same_content(ft_map, std_map));
+}
+
+void test_map_sorted_build(void) {
+    std::cout << "\t sorted build" << std::endl;
+
+    for (int n = 0; n < 70; ++n) {
+        std::vector< ft::pair< int, int > > sorted;
+        for (int i = 0; i < n; ++i) {
+            sorted.push_back(ft::make_pair(i * 2, i));
+        }
+        ft::map< int, int > built(sorted.begin(), sorted.end());
+        assert(built.size() == static_cast< size_t >(n) && is_valid_tree(built));
+        built.insert(ft::make_pair(-1, 0));
+        built.insert(ft::make_pair(n * 2 + 1, 0));
+        assert(is_valid_tree(built));
+        if (n > 0) {
+            assert(built.begin()->first == -1 && built.find(n * 2 - 2)->second == n - 1);
+        }
+    }
+
+    std::vector< ft::pair< int, int > > unsorted;
+    for (int i = 0; i < 50; ++i) {
+        unsorted.push_back(ft::make_pair(i < 30 ? i : 100 - i, i));
+    }
+    unsorted.push_back(ft::make_pair(5, -1));
+    ft::map< int, int > mixed(unsorted.begin(), unsorted.end());
+    assert(mixed.size() == 50 && is_valid_tree(mixed) && mixed[5] == 5);
+
+    std::istringstream stream("1 2 3");
+    ft::map< std::string, int > words;
+    std::string word;
+    while (stream >> word) {
+        words[word] += 1;
+    }
+    words["2"] += 1;
+    assert(words.size() == 3 && words.at("2") == 2);
+}
+
+void test_map_copy(void) {
+    std::cout << "\t copy / swap" << std::endl;
+
+    ft::map< std::string, std::string > first;
+    for (int i = 0; i < 100; ++i) {
+        std::string key(static_cast< size_t >(i % 10) + 1, static_cast< char >('a' + i / 10));
+        first[key] = key + "!";
+    }
+    ft::map< std::string, std::string > copy(first);
+    assert(copy == first && is_valid_tree(copy));
+    copy.erase("a");
+    assert(copy != first && copy > first);
+
+    ft::map< std::string, std::string > other;
+    other["z"] = "zz";
+    ft::swap(other, copy);
+    assert(copy.size() == 1 && other.size() == 99 && is_valid_tree(other));
+    assert(copy.begin()->second == "zz" && (--copy.end())->first == "z");
+
+    other = first;
+    assert(other == first);
+    other.clear();
+    assert(other.empty() && other.begin() == other.end());
+    other.insert(first.begin(), first.end());
+    assert(other == first);
+
+    try {
+        other.at("missing");
+        assert(false);
+    }
+    catch (const std::out_of_range&) {}
+
+    /* swap échange aussi les allocateurs : chaque map grandit dans l'arène
+       qui possède ses noeuds */
+    typedef ft::arena_allocator< ft::pair< const int, int > > arena_alloc;
+    ft::arena first_arena;
+    ft::arena second_arena;
+    arena_alloc first_alloc(first_arena);
+    arena_alloc second_alloc(second_arena);
+    ft::map< int, int, std::less< int >, arena_alloc > from_first(std::less< int >(), first_alloc);
+    ft::map< int, int, std::less< int >, arena_alloc > from_second(std::less< int >(),
+                                                                   second_alloc);
+    from_first[1] = 1;
+    from_second[2] = 2;
+    from_first.swap(from_second);
+    assert(from_first.get_allocator() == second_alloc && from_first.begin()->first == 2);
+    assert(from_second.get_allocator() == first_alloc && from_second.begin()->first == 1);
+    std::size_t first_left = first_arena.remaining();
+    std::size_t second_left = second_arena.remaining();
+    for (int i = 3; i < 500; ++i) {
+        from_first[i] = i;
+    }
+    assert(first_arena.remaining() == first_left && second_arena.remaining() != second_left);
+    assert(is_valid_tree(from_first));
+    ft::swap(from_first, from_second);
+    assert(from_first.get_allocator() == first_alloc && from_first.size() == 1);
+    assert(from_second.get_allocator() == second_alloc && from_second.size() == 498);
+}
+
+void test_map(void) {
+    std::cout << "Test: map" << std::endl;
+
+    test_map_tree();
+    test_map_sorted_build();
+    test_map_copy();
+}
@@ -0,0 +1,501 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapped_vector.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _MAPPED_VECTOR_HPP_
+#define _MAPPED_VECTOR_HPP_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "random_access_iterator.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+    /**
+     * @brief En-tête de SIZE octets placé au début du fichier d'un
+     * ft::mapped_vector, suivi directement des éléments. Taille et capacité
+     * y sont tenues à jour à chaque opération : rouvrir le fichier ne
+     * demande que de le projeter à nouveau.
+     */
+    struct mapped_vector_header {
+        static const unsigned int VERSION = 1;
+        static const std::size_t SIZE = 64;
+
+        char magic[8];
+        unsigned int version;
+        unsigned int element_size;
+        std::size_t size;
+        std::size_t capacity;
+
+        static const char* expected_magic() { return "FTMAPVEC"; }
+    };
+
+    /**
+     * @brief Un vecteur dont le stockage est un fichier projeté en mémoire
+     * (mmap partagé). Il offre l'interface de ft::vector et ses itérateurs
+     * ft::random_access_iterator ; grandir étend le fichier (ftruncate) puis
+     * le reprojette. Les éléments étant écrits tels quels, T doit être
+     * trivialement copiable, et le fichier n'est relu que sur une machine de
+     * même architecture. Comme pour ft::vector, une croissance invalide
+     * les itérateurs. Non copiable : deux objets ne partagent pas un fichier.
+     *
+     * @tparam T Type des éléments, trivialement copiable.
+     */
+    template < class T >
+    class mapped_vector {
+        private:
+            typedef char element_must_be_trivially_copyable
+                [ft::is_trivially_copyable< T >::value ? 1 : -1];
+
+        public:
+            typedef T value_type;
+            typedef T& reference;
+            typedef const T& const_reference;
+            typedef T* pointer;
+            typedef const T* const_pointer;
+            typedef typename ft::random_access_iterator< value_type > iterator;
+            typedef typename ft::random_access_iterator< const value_type > const_iterator;
+            typedef typename ft::reverse_iterator< iterator > reverse_iterator;
+            typedef typename ft::reverse_iterator< const_iterator > const_reverse_iterator;
+            typedef std::ptrdiff_t difference_type;
+            typedef std::size_t size_type;
+
+        private:
+            std::string _path;
+            int _fd;
+            char* _map;
+            std::size_t _mapped_bytes;
+
+            mapped_vector(const mapped_vector&);
+            mapped_vector& operator=(const mapped_vector&);
+
+        public:
+            /**
+             * @brief Vecteur fermé, sans fichier. Seuls open, is_open et les
+             * accès à la taille (nulle) sont alors permis.
+             */
+            mapped_vector() : _fd(-1), _map(u_nullptr), _mapped_bytes(0) {}
+
+            /**
+             * @brief Ouvre path, ou le crée vide s'il n'existe pas.
+             */
+            explicit mapped_vector(const std::string& path)
+                : _fd(-1), _map(u_nullptr), _mapped_bytes(0) {
+                this->open(path);
+            }
+
+            ~mapped_vector() { this->close(); }
+
+            /**
+             * @brief Ouvre path, ou le crée vide s'il n'existe pas. Un fichier
+             * existant est seulement projeté : son en-tête est vérifié, ses
+             * éléments ne sont pas relus. Lève std::runtime_error si le fichier
+             * n'est pas un mapped_vector de ce type d'élément.
+             */
+            void open(const std::string& path) {
+                this->close();
+                this->_path = path;
+                this->_fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+                if (this->_fd < 0) {
+                    this->_fail("open");
+                }
+                struct stat st;
+                if (fstat(this->_fd, &st) != 0) {
+                    this->_fail("fstat");
+                }
+                if (st.st_size == 0) {
+                    this->_remap(0);
+                    mapped_vector_header* header = this->_header();
+                    std::memcpy(header->magic, mapped_vector_header::expected_magic(),
+                                sizeof(header->magic));
+                    header->version = mapped_vector_header::VERSION;
+                    header->element_size = sizeof(T);
+                    header->size = 0;
+                    header->capacity = 0;
+                    return;
+                }
+                if (static_cast< std::size_t >(st.st_size) < mapped_vector_header::SIZE) {
+                    this->_invalid("truncated header");
+                }
+                this->_map_file(static_cast< std::size_t >(st.st_size));
+                const mapped_vector_header* header = this->_header();
+                if (std::memcmp(header->magic, mapped_vector_header::expected_magic(),
+                                sizeof(header->magic)) != 0 ||
+                    header->version != mapped_vector_header::VERSION) {
+                    this->_invalid("not a mapped_vector file");
+                }
+                if (header->element_size != sizeof(T)) {
+                    this->_invalid("element size mismatch");
+                }
+                if (header->size > header->capacity ||
+                    header->capacity > this->max_size() ||
+                    this->_file_size(header->capacity) > this->_mapped_bytes) {
+                    this->_invalid("truncated payload");
+                }
+            }
+
+            /**
+             * @brief Détache le fichier sans le supprimer. Le contenu est écrit
+             * par le noyau ; sync() garantit qu'il a atteint le disque.
+             */
+            void close() {
+                if (this->_map) {
+                    munmap(this->_map, this->_mapped_bytes);
+                    this->_map = u_nullptr;
+                    this->_mapped_bytes = 0;
+                }
+                if (this->_fd >= 0) {
+                    ::close(this->_fd);
+                    this->_fd = -1;
+                }
+            }
+
+            bool is_open() const { return this->_map != u_nullptr; }
+
+            const std::string& path() const { return this->_path; }
+
+            /**
+             * @brief Écrit les pages modifiées sur le disque (msync).
+             */
+            void sync() {
+                if (this->_map && msync(this->_map, this->_mapped_bytes, MS_SYNC) != 0) {
+                    this->_fail("msync");
+                }
+            }
+
+            iterator begin() { return this->_data(); }
+
+            const_iterator begin() const { return this->_data(); }
+
+            iterator end() { return this->_data() + this->size(); }
+
+            const_iterator end() const { return this->_data() + this->size(); }
+
+            reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+            const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+            reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+            const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+            size_type size() const { return this->_map ? this->_header()->size : 0; }
+
+            size_type max_size() const {
+                return (std::numeric_limits< size_type >::max() - mapped_vector_header::SIZE) /
+                    sizeof(T);
+            }
+
+            size_type capacity() const { return this->_map ? this->_header()->capacity : 0; }
+
+            bool empty() const { return this->size() == 0; }
+
+            void resize(size_type n, value_type val = value_type()) {
+                if (n <= this->size()) {
+                    this->_header()->size = n;
+                    return;
+                }
+                this->insert(this->end(), n - this->size(), val);
+            }
+
+            /**
+             * @brief Porte la capacité à au moins n : le fichier est étendu
+             * puis reprojeté, les éléments ne sont pas copiés par ce code.
+             */
+            void reserve(size_type n) {
+                if (n > this->max_size()) {
+                    throw std::length_error("ft::mapped_vector");
+                }
+                if (n > this->capacity()) {
+                    this->_remap(n);
+                }
+            }
+
+            /**
+             * @brief Ramène la capacité, et donc le fichier, à la taille.
+             */
+            void shrink_to_fit() {
+                if (this->capacity() > this->size()) {
+                    this->_remap(this->size());
+                }
+            }
+
+            reference operator[](size_type n) { return this->_data()[n]; }
+
+            const_reference operator[](size_type n) const { return this->_data()[n]; }
+
+            reference at(size_type n) {
+                if (n >= this->size()) {
+                    throw std::out_of_range("ft::mapped_vector");
+                }
+                return this->_data()[n];
+            }
+
+            const_reference at(size_type n) const {
+                if (n >= this->size()) {
+                    throw std::out_of_range("ft::mapped_vector");
+                }
+                return this->_data()[n];
+            }
+
+            reference front() { return this->_data()[0]; }
+
+            const_reference front() const { return this->_data()[0]; }
+
+            reference back() { return this->_data()[this->size() - 1]; }
+
+            const_reference back() const { return this->_data()[this->size() - 1]; }
+
+            template < class InputIterator >
+            void assign(
+                InputIterator first, InputIterator last,
+                typename ft::enable_if<
+                    !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+                this->clear();
+                this->insert(this->end(), first, last);
+            }
+
+            void assign(size_type n, const value_type& val) {
+                value_type tmp(val);
+                this->clear();
+                this->insert(this->end(), n, tmp);
+            }
+
+            void push_back(const value_type& val) {
+                if (this->size() == this->capacity()) {
+                    value_type tmp(val);
+                    this->_grow(this->size() + 1);
+                    this->_data()[this->_header()->size++] = tmp;
+                    return;
+                }
+                this->_data()[this->_header()->size++] = val;
+            }
+
+            void pop_back() { --this->_header()->size; }
+
+            iterator insert(iterator position, const value_type& val) {
+                size_type pos_at = position - this->begin();
+                this->insert(position, 1, val);
+                return this->begin() + pos_at;
+            }
+
+            void insert(iterator position, size_type n, const value_type& val) {
+                if (n == 0) {
+                    return;
+                }
+                value_type tmp(val);
+                pointer gap = this->_make_gap(position - this->begin(), n);
+                for (size_type i = 0; i < n; ++i) {
+                    gap[i] = tmp;
+                }
+            }
+
+            template < class InputIterator >
+            void insert(
+                iterator position, InputIterator first, InputIterator last,
+                typename ft::enable_if<
+                    !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
+                this->_range_insert(position - this->begin(), first, last,
+                                    typename ft::iterator_category_of< InputIterator >::type());
+            }
+
+            iterator erase(iterator position) { return this->erase(position, position + 1); }
+
+            /**
+             * @brief Retire [first, last) en un seul memmove de la fin.
+             */
+            iterator erase(iterator first, iterator last) {
+                pointer p_first = first.base();
+                pointer p_last = last.base();
+                pointer p_end = this->_data() + this->size();
+                if (p_first != p_last) {
+                    std::memmove(static_cast< void* >(p_first), static_cast< const void* >(p_last),
+                                (p_end - p_last) * sizeof(T));
+                    this->_header()->size -= p_last - p_first;
+                }
+                return first;
+            }
+
+            /**
+             * @brief Échange les fichiers de deux vecteurs.
+             */
+            void swap(mapped_vector& x) {
+                this->_path.swap(x._path);
+                int fd = this->_fd;
+                this->_fd = x._fd;
+                x._fd = fd;
+                char* map = this->_map;
+                this->_map = x._map;
+                x._map = map;
+                std::size_t mapped_bytes = this->_mapped_bytes;
+                this->_mapped_bytes = x._mapped_bytes;
+                x._mapped_bytes = mapped_bytes;
+            }
+
+            void clear() {
+                if (this->_map) {
+                    this->_header()->size = 0;
+                }
+            }
+
+        private:
+            mapped_vector_header* _header() const {
+                return reinterpret_cast< mapped_vector_header* >(this->_map);
+            }
+
+            pointer _data() const {
+                return this->_map
+                    ? reinterpret_cast< pointer >(this->_map + mapped_vector_header::SIZE)
+                    : u_nullptr;
+            }
+
+            std::size_t _file_size(size_type capacity) const {
+                return mapped_vector_header::SIZE + capacity * sizeof(T);
+            }
+
+            void _fail(const char* what) {
+                std::string message =
+                    "ft::mapped_vector: " + this->_path + ": " + what + ": " + std::strerror(errno);
+                this->close();
+                throw std::runtime_error(message);
+            }
+
+            void _invalid(const char* what) {
+                std::string message = "ft::mapped_vector: " + this->_path + ": " + what;
+                this->close();
+                throw std::runtime_error(message);
+            }
+
+            /**
+             * @brief Projette les bytes premiers octets du fichier ouvert, en
+             * remplaçant la projection courante. Sous Linux, mremap déplace
+             * la projection sans toucher aux pages.
+             */
+            void _map_file(std::size_t bytes) {
+                void* next;
+#ifdef __linux__
+                if (this->_map) {
+                    next = mremap(this->_map, this->_mapped_bytes, bytes, MREMAP_MAYMOVE);
+                } else {
+                    next = mmap(u_nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0);
+                }
+#else
+                if (this->_map) {
+                    munmap(this->_map, this->_mapped_bytes);
+                    this->_map = u_nullptr;
+                }
+                next = mmap(u_nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0);
+#endif
+                if (next == MAP_FAILED) {
+                    this->_fail("mmap");
+                }
+                this->_map = static_cast< char* >(next);
+                this->_mapped_bytes = bytes;
+            }
+
+            /**
+             * @brief Redimensionne le fichier pour capacity éléments et le
+             * reprojette. La taille est conservée.
+             */
+            void _remap(size_type capacity) {
+                std::size_t bytes = this->_file_size(capacity);
+                if (ftruncate(this->_fd, static_cast< off_t >(bytes)) != 0) {
+                    this->_fail("ftruncate");
+                }
+                this->_map_file(bytes);
+                this->_header()->capacity = capacity;
+            }
+
+            /**
+             * @brief Assure une capacité d'au moins n, au minimum doublée comme
+             * pour ft::vector.
+             */
+            void _grow(size_type n) {
+                if (n > this->max_size()) {
+                    throw std::length_error("ft::mapped_vector");
+                }
+                size_type capacity = this->capacity();
+                if (capacity >= n) {
+                    return;
+                }
+                this->_remap(capacity * 2 > n ? capacity * 2 : n);
+            }
+
+            pointer _make_gap(size_type pos_at, size_type n) {
+                size_type prev_size = this->size();
+                this->_grow(prev_size + n);
+                pointer gap = this->_data() + pos_at;
+                std::memmove(static_cast< void* >(gap + n), static_cast< const void* >(gap),
+                            (prev_size - pos_at) * sizeof(T));
+                this->_header()->size = prev_size + n;
+                return gap;
+            }
+
+            template < class InputIterator >
+            void _range_insert(size_type pos_at, InputIterator first, InputIterator last,
+                            ft::input_iterator_tag) {
+                if (pos_at == this->size()) {
+                    for (; first != last; ++first) {
+                        this->push_back(*first);
+                    }
+                    return;
+                }
+                ft::vector< T > tmp(first, last);
+                this->_range_insert(pos_at, tmp.begin(), tmp.end(),
+                                    ft::random_access_iterator_tag());
+            }
+
+            template < class ForwardIterator >
+            void _range_insert(size_type pos_at, ForwardIterator first, ForwardIterator last,
+                            ft::forward_iterator_tag) {
+                size_type n = ft::distance(first, last);
+                if (n == 0) {
+                    return;
+                }
+                pointer gap = this->_make_gap(pos_at, n);
+                for (size_type i = 0; i < n; ++i) {
+                    gap[i] = *first++;
+                }
+            }
+    };
+
+    template < class T >
+    bool operator==(const mapped_vector< T >& lhs, const mapped_vector< T >& rhs) {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template < class T >
+    bool operator!=(const mapped_vector< T >& lhs, const mapped_vector< T >& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template < class T >
+    void swap(mapped_vector< T >& x, mapped_vector< T >& y) {
+        x.swap(y);
+    }
+}
+
+#endif
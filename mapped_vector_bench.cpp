@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapped_vector_bench.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "mapped_vector.hpp"
+#include "vector.hpp"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "bench.hpp"
+
+namespace {
+    const std::size_t ELEMENT_COUNT = std::size_t(1) << 24;
+
+    /**
+     * @brief Reconstruction d'une table de ELEMENT_COUNT entrées par push_back,
+     * valeurs tirées de bench::lcg comme le ferait un chargement.
+     */
+    template < class Vector >
+    void fill(Vector& v) {
+        bench::lcg rng(42);
+        for (std::size_t i = 0; i < ELEMENT_COUNT; ++i) {
+            v.push_back(rng.next(ELEMENT_COUNT));
+        }
+    }
+
+    template < class Vector >
+    unsigned long checksum(const Vector& v) {
+        unsigned long sum = 0;
+        for (std::size_t i = 0; i < v.size(); i += 4096) {
+            sum += v[i];
+        }
+        return sum;
+    }
+}
+
+/**
+ * @brief Redémarrage d'un service : reconstruire une table de 128 Mio par
+ * push_back dans un ft::vector, face à rouvrir le fichier d'un
+ * ft::mapped_vector déjà rempli (projection seule, une lecture par page
+ * de 4096 éléments pour en toucher une partie).
+ */
+void bench_mapped_vector(void) {
+    std::ostringstream path;
+    path << "/tmp/ft_mapped_vector_bench_" << getpid();
+    std::remove(path.str().c_str());
+
+    std::cout << "Bench: mapped_vector, " << ELEMENT_COUNT << " unsigned long" << std::endl;
+    unsigned long sink = 0;
+
+    double start = bench::now_ns();
+    {
+        ft::vector< unsigned long > table;
+        fill(table);
+        sink += checksum(table);
+    }
+    std::cout << "\t ft::vector rebuild with push_back: " << (bench::now_ns() - start) / 1e6
+            << " ms" << std::endl;
+
+    start = bench::now_ns();
+    {
+        ft::mapped_vector< unsigned long > table(path.str());
+        fill(table);
+        table.sync();
+    }
+    std::cout << "\t ft::mapped_vector build + sync: " << (bench::now_ns() - start) / 1e6
+            << " ms" << std::endl;
+
+    start = bench::now_ns();
+    {
+        ft::mapped_vector< unsigned long > table(path.str());
+        sink += checksum(table);
+    }
+    std::cout << "\t ft::mapped_vector reopen: " << (bench::now_ns() - start) / 1e6 << " ms"
+            << std::endl;
+
+    std::remove(path.str().c_str());
+    if (sink == 1) {
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapped_vector_test.cpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "mapped_vector.hpp"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    struct sample {
+        long key;
+        double weight;
+    };
+
+    std::string temporary_path(const char* name) {
+        std::ostringstream path;
+        path << "/tmp/ft_mapped_vector_" << name << "_" << getpid();
+        return path.str();
+    }
+
+    std::size_t file_size(const std::string& path) {
+        struct stat st;
+        assert(stat(path.c_str(), &st) == 0);
+        return static_cast< std::size_t >(st.st_size);
+    }
+}
+
+void test_mapped_vector(void) {
+    std::cout << "Test: mapped_vector" << std::endl;
+
+    std::string path = temporary_path("ints");
+    std::remove(path.c_str());
+    std::vector< int > expected;
+    {
+        ft::mapped_vector< int > ints(path);
+        assert(ints.is_open() && ints.empty() && ints.capacity() == 0);
+        for (int i = 0; i < 10000; ++i) {
+            ints.push_back(i);
+            expected.push_back(i);
+        }
+        ints.insert(ints.begin() + 7, 3, -1);
+        expected.insert(expected.begin() + 7, 3, -1);
+        ints.erase(ints.begin() + 100, ints.begin() + 200);
+        expected.erase(expected.begin() + 100, expected.begin() + 200);
+        int more[] = {11, 22, 33};
+        ints.insert(ints.begin() + 50, more, more + 3);
+        expected.insert(expected.begin() + 50, more, more + 3);
+        ints.sync();
+
+        assert(ints.size() == expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            assert(ints[i] == expected[i]);
+        }
+        ft::mapped_vector< int >::reverse_iterator rit = ints.rbegin();
+        assert(*rit == 9999 && ints.rend() - ints.rbegin() == static_cast< long >(ints.size()));
+        assert(file_size(path) == ft::mapped_vector_header::SIZE + ints.capacity() * sizeof(int));
+    }
+    {
+        ft::mapped_vector< int > reopened(path);
+        assert(reopened.size() == expected.size() && reopened.capacity() >= expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            assert(reopened[i] == expected[i]);
+        }
+        reopened.resize(10);
+        reopened.shrink_to_fit();
+        assert(reopened.capacity() == 10);
+        assert(file_size(path) == ft::mapped_vector_header::SIZE + 10 * sizeof(int));
+        reopened.push_back(42);
+        assert(reopened.size() == 11 && reopened.back() == 42 && reopened.front() == 0);
+
+        bool thrown = false;
+        try {
+            reopened.at(11);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    bool mismatch = false;
+    try {
+        ft::mapped_vector< double > wrong(path);
+    } catch (const std::runtime_error&) {
+        mismatch = true;
+    }
+    assert(mismatch);
+
+    std::FILE* garbage = std::fopen(path.c_str(), "w");
+    assert(garbage);
+    std::fputs("not a mapped vector, just some text that is long enough for a header....", garbage);
+    std::fclose(garbage);
+    bool invalid = false;
+    ft::mapped_vector< int > closed;
+    try {
+        closed.open(path);
+    } catch (const std::runtime_error&) {
+        invalid = true;
+    }
+    assert(invalid && !closed.is_open());
+    std::remove(path.c_str());
+
+    std::string samples_path = temporary_path("samples");
+    std::remove(samples_path.c_str());
+    {
+        ft::mapped_vector< sample > samples(samples_path);
+        samples.reserve(1000);
+        assert(samples.capacity() == 1000);
+        sample s = {0, 0.0};
+        samples.assign(500, s);
+        for (long i = 0; i < 500; ++i) {
+            samples[static_cast< std::size_t >(i)].key = i;
+            samples[static_cast< std::size_t >(i)].weight = i * 0.25;
+        }
+    }
+    {
+        ft::mapped_vector< sample > samples;
+        samples.open(samples_path);
+        assert(samples.size() == 500 && samples.capacity() == 1000);
+        long sum = 0;
+        for (ft::mapped_vector< sample >::const_iterator it = samples.begin();
+            it != samples.end(); ++it) {
+            sum += it->key;
+        }
+        assert(sum == 499 * 500 / 2 && samples[499].weight == 499 * 0.25);
+
+        std::string other_path = temporary_path("other");
+        std::remove(other_path.c_str());
+        ft::mapped_vector< sample > other(other_path);
+        other.push_back(samples[3]);
+        ft::swap(samples, other);
+        assert(samples.size() == 1 && samples[0].key == 3 && other.size() == 500);
+        assert(samples.path() == other_path);
+        samples.close();
+        std::remove(other_path.c_str());
+    }
+    std::remove(samples_path.c_str());
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memory.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _MEMORY_HPP_
+#define _MEMORY_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+#include "type_traits.hpp"
+#include "util.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Point d'extension des allocateurs utilisé par ft::vector pour
+     * grandir sans réallouer, ou en réallouant au mieux.
+     * try_expand tente d'agrandir en place le bloc p de old_n à new_n
+     * éléments ; en cas de succès les éléments restent à leur adresse et
+     * le bloc doit ensuite être libéré avec la nouvelle taille.
+     * allocate_at_least alloue au moins n éléments et écrit dans count la
+     * capacité réellement utilisable, qui devient celle du conteneur.
+     * Si can_reallocate est vrai, reallocate(alloc, p, old_n, new_n, count)
+     * déplace le bloc et ses octets vers un bloc d'au moins new_n éléments ;
+     * ft::vector ne l'appelle que pour des éléments trivialement relogeables.
+     * Par défaut l'extension échoue toujours et l'allocation est exacte. Un
+     * allocateur active ce qu'il sait faire en spécialisant ce trait, de
+     * préférence en héritant des comportements par défaut :
+     *
+     * template < class T >
+     * struct allocator_expansion< my_allocator< T > >
+     *     : public allocator_expansion_base< my_allocator< T > > { ... };
+     *
+     * @tparam Alloc type de l'allocateur
+     */
+    template < class Alloc >
+    struct allocator_expansion_base {
+        typedef typename Alloc::pointer pointer;
+        typedef typename Alloc::size_type size_type;
+
+        static const bool can_reallocate = false;
+
+        static bool try_expand(Alloc&, pointer, size_type, size_type) { return false; }
+
+        static pointer allocate_at_least(Alloc& alloc, size_type n, size_type& count) {
+            pointer p = alloc.allocate(n);
+            count = n;
+            return p;
+        }
+    };
+
+    template < class Alloc >
+    struct allocator_expansion : public allocator_expansion_base< Alloc > {};
+
+    /**
+     * @brief Stockage brut, non construit, de N objets de type T, aligné
+     * comme les types fondamentaux les plus exigeants.
+     */
+    template < class T, std::size_t N >
+    struct aligned_buffer {
+        union {
+            char bytes[N * sizeof(T)];
+            long double align_ld;
+            void* align_ptr;
+            long align_long;
+        } storage;
+
+        T* data() { return reinterpret_cast< T* >(this->storage.bytes); }
+
+        const T* data() const { return reinterpret_cast< const T* >(this->storage.bytes); }
+    };
+
+    /**
+     * @brief Déplace un objet de src vers l'emplacement non construit dst,
+     * puis détruit src. En C++11, l'objet est déplacé si son constructeur par
+     * déplacement ne peut pas lever d'exception, copié sinon.
+     */
+    template < class T >
+    void relocate_one(T* dst, T* src) {
+#ifdef FT_CONTAINERS_CXX11
+        ::new (static_cast< void* >(dst)) T(std::move_if_noexcept(*src));
+#else
+        ::new (static_cast< void* >(dst)) T(*src);
+#endif
+        src->~T();
+    }
+
+    template < class T >
+    void relocate(T* dst, T* src, std::size_t n, ft::true_type) {
+        if (n != 0 && dst != src) {
+            std::memmove(static_cast< void* >(dst), static_cast< const void* >(src),
+                        n * sizeof(T));
+        }
+    }
+
+    template < class T >
+    void relocate(T* dst, T* src, std::size_t n, ft::false_type) {
+        if (dst < src) {
+            for (std::size_t i = 0; i < n; ++i) {
+                ft::relocate_one(dst + i, src + i);
+            }
+        } else if (dst > src) {
+            for (std::size_t i = n; i > 0; --i) {
+                ft::relocate_one(dst + i - 1, src + i - 1);
+            }
+        }
+    }
+
+    /**
+     * @brief Déplace n objets de src vers dst, les deux intervalles pouvant
+     * se chevaucher. Après l'appel, [dst, dst + n) est construit et les
+     * emplacements de src qui ne recouvrent pas dst sont non construits.
+     * Les types trivialement relogeables sont déplacés en un seul memmove.
+     */
+    template < class T >
+    void relocate(T* dst, T* src, std::size_t n) {
+        ft::relocate(dst, src, n, ft::is_trivially_relocatable< T >());
+    }
+}
+
+#endif
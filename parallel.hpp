@@ -0,0 +1,607 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _PARALLEL_HPP_
+#define _PARALLEL_HPP_
+
+#include <cstddef>
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "thread_pool.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+/*
+ * Algorithmes parallèles sur des intervalles à accès aléatoire
+ * (ft::random_access_iterator, pointeurs) : l'intervalle est découpé en
+ * CHUNKS_PER_THREAD blocs par thread de ft::parallel::default_pool(). Sous
+ * sequential_threshold() éléments, ou pour d'autres catégories
+ * d'itérateurs, ils s'exécutent séquentiellement sur le thread appelant.
+ *
+ * Les foncteurs sont appelés depuis plusieurs threads à la fois : chaque
+ * bloc en utilise sa propre copie, et ils ne doivent pas modifier d'état
+ * partagé sans le synchroniser. Une exception levée dans un bloc est
+ * remplacée par std::runtime_error une fois tous les blocs terminés.
+ */
+namespace ft {
+    namespace parallel {
+
+        static const std::size_t DEFAULT_SEQUENTIAL_THRESHOLD = std::size_t(1) << 15;
+        static const std::size_t CHUNKS_PER_THREAD = 4;
+        /* Pas auquel equal et mismatch vérifient si un autre bloc a conclu */
+        static const std::size_t EARLY_EXIT_BLOCK = std::size_t(1) << 16;
+
+        inline std::size_t& threshold_storage() {
+            static std::size_t threshold = DEFAULT_SEQUENTIAL_THRESHOLD;
+            return threshold;
+        }
+
+        /**
+         * @brief Taille d'intervalle en dessous de laquelle les algorithmes
+         * restent séquentiels : en deçà, répartir le travail coûte plus cher
+         * que le faire.
+         */
+        inline std::size_t sequential_threshold() { return threshold_storage(); }
+
+        /**
+         * @brief Change le seuil, pour tout le processus. À régler avant de
+         * lancer des algorithmes depuis plusieurs threads.
+         */
+        inline void set_sequential_threshold(std::size_t n) { threshold_storage() = n; }
+
+        /**
+         * @brief Groupe de threads partagé par les algorithmes de
+         * ft::parallel, créé au premier appel avec un thread par processeur.
+         */
+        inline thread_pool& default_pool() {
+            static thread_pool pool;
+            return pool;
+        }
+
+        /**
+         * @brief Vrai si Iterator est à accès aléatoire, seule catégorie que
+         * l'on sait découper en blocs en temps constant.
+         */
+        template < class Iterator >
+        struct is_random_access
+            : public ft::is_same< typename ft::iterator_category_of< Iterator >::type,
+                                ft::random_access_iterator_tag > {};
+
+        /**
+         * @brief Base des tâches : découpe [0, size) en chunks blocs de
+         * tailles égales à un élément près.
+         */
+        struct chunked_task : public thread_pool::task {
+            std::size_t size;
+            std::size_t chunks;
+
+            explicit chunked_task(std::size_t n) : size(n), chunks(chunk_count(n)) {}
+
+            std::size_t chunk_begin(std::size_t i) const {
+                std::size_t quotient = this->size / this->chunks;
+                std::size_t remainder = this->size % this->chunks;
+                return i * quotient + (i < remainder ? i : remainder);
+            }
+
+            std::size_t chunk_end(std::size_t i) const { return this->chunk_begin(i + 1); }
+
+            static std::size_t chunk_count(std::size_t n) {
+                std::size_t chunks = default_pool().size() * CHUNKS_PER_THREAD;
+                return n < chunks ? (n ? n : 1) : chunks;
+            }
+
+            void start() { default_pool().run(*this, this->chunks); }
+        };
+
+        /**
+         * @brief Drapeau partagé entre blocs, lu et écrit atomiquement : un
+         * bloc qui a conclu l'algorithme l'abaisse pour que les autres
+         * s'arrêtent au prochain EARLY_EXIT_BLOCK.
+         */
+        class chunk_flag {
+            private:
+                std::size_t _value;
+
+            public:
+                explicit chunk_flag(std::size_t value) : _value(value) {}
+
+                std::size_t load() const {
+                    return __atomic_load_n(&this->_value, __ATOMIC_RELAXED);
+                }
+
+                /**
+                 * @brief Remplace la valeur par value si elle est plus petite.
+                 */
+                void lower_to(std::size_t value) {
+                    std::size_t current = this->load();
+                    while (value < current &&
+                        !__atomic_compare_exchange_n(&this->_value, &current, value, true,
+                                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                    }
+                }
+        };
+
+        /* for_each ------------------------------------------------------- */
+
+        template < class RandomAccessIterator, class Function >
+        struct for_each_task : public chunked_task {
+            RandomAccessIterator first;
+            Function f;
+
+            for_each_task(RandomAccessIterator first, std::size_t n, Function f)
+                : chunked_task(n), first(first), f(f) {}
+
+            void run(std::size_t i) {
+                Function local(this->f);
+                RandomAccessIterator it = this->first + this->chunk_begin(i);
+                RandomAccessIterator end = this->first + this->chunk_end(i);
+                for (; it != end; ++it) {
+                    local(*it);
+                }
+            }
+        };
+
+        template < class InputIterator, class Function >
+        void for_each_impl(InputIterator first, InputIterator last, Function f, ft::false_type) {
+            for (; first != last; ++first) {
+                f(*first);
+            }
+        }
+
+        template < class RandomAccessIterator, class Function >
+        void for_each_impl(RandomAccessIterator first, RandomAccessIterator last, Function f,
+                            ft::true_type) {
+            std::size_t n = last - first;
+            if (n < sequential_threshold()) {
+                return ft::parallel::for_each_impl(first, last, f, ft::false_type());
+            }
+            for_each_task< RandomAccessIterator, Function > task(first, n, f);
+            task.start();
+        }
+
+        /**
+         * @brief Applique f à chaque élément de [first, last), dans un ordre
+         * quelconque.
+         */
+        template < class InputIterator, class Function >
+        void for_each(InputIterator first, InputIterator last, Function f) {
+            ft::parallel::for_each_impl(first, last, f, is_random_access< InputIterator >());
+        }
+
+        /* transform ------------------------------------------------------ */
+
+        template < class Iterator, class OutputIterator, class UnaryOperation >
+        struct unary_transform_task : public chunked_task {
+            Iterator first;
+            OutputIterator result;
+            UnaryOperation op;
+
+            unary_transform_task(Iterator first, std::size_t n, OutputIterator result,
+                                UnaryOperation op)
+                : chunked_task(n), first(first), result(result), op(op) {}
+
+            void run(std::size_t i) {
+                UnaryOperation local(this->op);
+                std::size_t begin = this->chunk_begin(i);
+                Iterator it = this->first + begin;
+                Iterator end = this->first + this->chunk_end(i);
+                OutputIterator out = this->result + begin;
+                for (; it != end; ++it, ++out) {
+                    *out = local(*it);
+                }
+            }
+        };
+
+        template < class InputIterator, class OutputIterator, class UnaryOperation >
+        OutputIterator transform_impl(InputIterator first, InputIterator last,
+                                    OutputIterator result, UnaryOperation op, ft::false_type) {
+            for (; first != last; ++first, ++result) {
+                *result = op(*first);
+            }
+            return result;
+        }
+
+        template < class RandomAccessIterator1, class RandomAccessIterator2,
+                class UnaryOperation >
+        RandomAccessIterator2 transform_impl(RandomAccessIterator1 first,
+                                            RandomAccessIterator1 last,
+                                            RandomAccessIterator2 result, UnaryOperation op,
+                                            ft::true_type) {
+            std::size_t n = last - first;
+            if (n < sequential_threshold()) {
+                return ft::parallel::transform_impl(first, last, result, op, ft::false_type());
+            }
+            unary_transform_task< RandomAccessIterator1, RandomAccessIterator2, UnaryOperation >
+                task(first, n, result, op);
+            task.start();
+            return result + n;
+        }
+
+        template < class Iterator1, class Iterator2, class OutputIterator, class BinaryOperation >
+        struct transform_task : public chunked_task {
+            Iterator1 first1;
+            Iterator2 first2;
+            OutputIterator result;
+            BinaryOperation op;
+
+            transform_task(Iterator1 first1, std::size_t n, Iterator2 first2,
+                        OutputIterator result, BinaryOperation op)
+                : chunked_task(n), first1(first1), first2(first2), result(result), op(op) {}
+
+            void run(std::size_t i) {
+                BinaryOperation local(this->op);
+                std::size_t begin = this->chunk_begin(i);
+                std::size_t end = this->chunk_end(i);
+                Iterator1 it1 = this->first1 + begin;
+                Iterator2 it2 = this->first2 + begin;
+                OutputIterator out = this->result + begin;
+                for (; begin != end; ++begin, ++it1, ++it2, ++out) {
+                    *out = local(*it1, *it2);
+                }
+            }
+        };
+
+        template < class InputIterator1, class InputIterator2, class OutputIterator,
+                class BinaryOperation >
+        OutputIterator transform_impl(InputIterator1 first1, InputIterator1 last1,
+                                    InputIterator2 first2, OutputIterator result,
+                                    BinaryOperation op, ft::false_type) {
+            for (; first1 != last1; ++first1, ++first2, ++result) {
+                *result = op(*first1, *first2);
+            }
+            return result;
+        }
+
+        template < class RandomAccessIterator1, class RandomAccessIterator2,
+                class RandomAccessIterator3, class BinaryOperation >
+        RandomAccessIterator3 transform_impl(RandomAccessIterator1 first1,
+                                            RandomAccessIterator1 last1,
+                                            RandomAccessIterator2 first2,
+                                            RandomAccessIterator3 result, BinaryOperation op,
+                                            ft::true_type) {
+            std::size_t n = last1 - first1;
+            if (n < sequential_threshold()) {
+                return ft::parallel::transform_impl(first1, last1, first2, result, op,
+                                                    ft::false_type());
+            }
+            transform_task< RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3,
+                            BinaryOperation >
+                task(first1, n, first2, result, op);
+            task.start();
+            return result + n;
+        }
+
+        /**
+         * @brief Écrit op(x) dans result pour chaque x de [first, last) ;
+         * renvoie la fin de l'intervalle écrit.
+         */
+        template < class InputIterator, class OutputIterator, class UnaryOperation >
+        OutputIterator transform(InputIterator first, InputIterator last, OutputIterator result,
+                                UnaryOperation op) {
+            return ft::parallel::transform_impl(
+                first, last, result, op,
+                ft::bool_constant< is_random_access< InputIterator >::value &&
+                                is_random_access< OutputIterator >::value >());
+        }
+
+        /**
+         * @brief Écrit op(x, y) dans result pour chaque x de [first1, last1)
+         * et y de l'intervalle commençant en first2.
+         */
+        template < class InputIterator1, class InputIterator2, class OutputIterator,
+                class BinaryOperation >
+        OutputIterator transform(InputIterator1 first1, InputIterator1 last1,
+                                InputIterator2 first2, OutputIterator result,
+                                BinaryOperation op) {
+            return ft::parallel::transform_impl(
+                first1, last1, first2, result, op,
+                ft::bool_constant< is_random_access< InputIterator1 >::value &&
+                                is_random_access< InputIterator2 >::value &&
+                                is_random_access< OutputIterator >::value >());
+        }
+
+        /* mismatch, equal ------------------------------------------------ */
+
+        /**
+         * @brief Prédicat par défaut de mismatch et equal.
+         */
+        struct equal_to {
+            template < class T, class U >
+            bool operator()(const T& x, const U& y) const {
+                return x == y;
+            }
+        };
+
+        template < class InputIterator1, class InputIterator2, class BinaryPredicate >
+        ft::pair< InputIterator1, InputIterator2 > mismatch_sequential(
+            InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+            BinaryPredicate pred) {
+            while (first1 != last1 && pred(*first1, *first2)) {
+                ++first1;
+                ++first2;
+            }
+            return ft::make_pair(first1, first2);
+        }
+
+        /**
+         * @brief Égalité d'un sous-intervalle : ft::equal (memcmp ou noyaux
+         * vectoriels) pour le prédicat par défaut, boucle sinon.
+         */
+        template < class Iterator1, class Iterator2 >
+        bool block_equal(Iterator1 first1, Iterator1 last1, Iterator2 first2, equal_to) {
+            return ft::equal(first1, last1, first2);
+        }
+
+        template < class Iterator1, class Iterator2, class BinaryPredicate >
+        bool block_equal(Iterator1 first1, Iterator1 last1, Iterator2 first2,
+                        BinaryPredicate pred) {
+            return ft::equal(first1, last1, first2, pred);
+        }
+
+        /**
+         * @brief Cherche la première différence. Chaque bloc avance par pas
+         * de EARLY_EXIT_BLOCK, en comparant d'abord le pas d'un bloc avec
+         * block_equal, et s'arrête dès qu'un bloc précédent a trouvé une
+         * différence : found est alors la position de la première.
+         */
+        template < class Iterator1, class Iterator2, class BinaryPredicate >
+        struct mismatch_task : public chunked_task {
+            Iterator1 first1;
+            Iterator2 first2;
+            BinaryPredicate pred;
+            chunk_flag found;
+
+            mismatch_task(Iterator1 first1, std::size_t n, Iterator2 first2,
+                        BinaryPredicate pred)
+                : chunked_task(n), first1(first1), first2(first2), pred(pred), found(n) {}
+
+            void run(std::size_t i) {
+                BinaryPredicate local(this->pred);
+                std::size_t end = this->chunk_end(i);
+                for (std::size_t begin = this->chunk_begin(i); begin < end;) {
+                    if (this->found.load() < begin) {
+                        return;
+                    }
+                    std::size_t step = end - begin < EARLY_EXIT_BLOCK ? end - begin
+                                                                        : EARLY_EXIT_BLOCK;
+                    Iterator1 it1 = this->first1 + begin;
+                    Iterator2 it2 = this->first2 + begin;
+                    if (!ft::parallel::block_equal(it1, it1 + step, it2, local)) {
+                        ft::pair< Iterator1, Iterator2 > at =
+                            ft::parallel::mismatch_sequential(it1, it1 + step, it2, local);
+                        this->found.lower_to(at.first - this->first1);
+                        return;
+                    }
+                    begin += step;
+                }
+            }
+        };
+
+        template < class InputIterator1, class InputIterator2, class BinaryPredicate >
+        ft::pair< InputIterator1, InputIterator2 > mismatch_impl(
+            InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+            BinaryPredicate pred, ft::false_type) {
+            return ft::parallel::mismatch_sequential(first1, last1, first2, pred);
+        }
+
+        template < class RandomAccessIterator1, class RandomAccessIterator2,
+                class BinaryPredicate >
+        ft::pair< RandomAccessIterator1, RandomAccessIterator2 > mismatch_impl(
+            RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+            RandomAccessIterator2 first2, BinaryPredicate pred, ft::true_type) {
+            std::size_t n = last1 - first1;
+            if (n < sequential_threshold()) {
+                return ft::parallel::mismatch_sequential(first1, last1, first2, pred);
+            }
+            mismatch_task< RandomAccessIterator1, RandomAccessIterator2, BinaryPredicate > task(
+                first1, n, first2, pred);
+            task.start();
+            std::size_t at = task.found.load();
+            return ft::make_pair(first1 + at, first2 + at);
+        }
+
+        /**
+         * @brief Renvoie la première paire d'éléments différents de
+         * [first1, last1) et de l'intervalle commençant en first2, ou
+         * (last1, first2 + (last1 - first1)) s'il n'y en a pas.
+         */
+        template < class InputIterator1, class InputIterator2, class BinaryPredicate >
+        ft::pair< InputIterator1, InputIterator2 > mismatch(InputIterator1 first1,
+                                                            InputIterator1 last1,
+                                                            InputIterator2 first2,
+                                                            BinaryPredicate pred) {
+            return ft::parallel::mismatch_impl(
+                first1, last1, first2, pred,
+                ft::bool_constant< is_random_access< InputIterator1 >::value &&
+                                is_random_access< InputIterator2 >::value >());
+        }
+
+        template < class InputIterator1, class InputIterator2 >
+        ft::pair< InputIterator1, InputIterator2 > mismatch(InputIterator1 first1,
+                                                            InputIterator1 last1,
+                                                            InputIterator2 first2) {
+            return ft::parallel::mismatch(first1, last1, first2, equal_to());
+        }
+
+        /**
+         * @brief Vrai si [first1, last1) et l'intervalle commençant en first2
+         * sont égaux élément par élément. Comme pour mismatch, un bloc
+         * s'arrête dès qu'une différence a été trouvée avant lui.
+         */
+        template < class InputIterator1, class InputIterator2 >
+        bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
+            return ft::parallel::mismatch(first1, last1, first2).first == last1;
+        }
+
+        template < class InputIterator1, class InputIterator2, class BinaryPredicate >
+        bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                BinaryPredicate pred) {
+            return ft::parallel::mismatch(first1, last1, first2, pred).first == last1;
+        }
+
+        /* reduce --------------------------------------------------------- */
+
+        /**
+         * @brief Opération par défaut de reduce.
+         */
+        struct plus {
+            template < class T, class U >
+            T operator()(const T& x, const U& y) const {
+                return x + y;
+            }
+        };
+
+        /**
+         * @brief Chaque bloc non vide réduit ses éléments dans partials[i] ;
+         * les résultats partiels sont ensuite combinés dans l'ordre des blocs,
+         * en sautant ceux des blocs vides.
+         */
+        template < class RandomAccessIterator, class T, class BinaryOperation >
+        struct reduce_task : public chunked_task {
+            RandomAccessIterator first;
+            BinaryOperation op;
+            ft::vector< T > partials;
+
+            reduce_task(RandomAccessIterator first, std::size_t n, const T& init,
+                        BinaryOperation op)
+                : chunked_task(n), first(first), op(op), partials(this->chunks, init) {}
+
+            void run(std::size_t i) {
+                BinaryOperation local(this->op);
+                RandomAccessIterator it = this->first + this->chunk_begin(i);
+                RandomAccessIterator end = this->first + this->chunk_end(i);
+                if (it == end) {
+                    return;
+                }
+                T sum = *it;
+                for (++it; it != end; ++it) {
+                    sum = local(sum, *it);
+                }
+                this->partials[i] = sum;
+            }
+        };
+
+        template < class InputIterator, class T, class BinaryOperation >
+        T reduce_impl(InputIterator first, InputIterator last, T init, BinaryOperation op,
+                    ft::false_type) {
+            for (; first != last; ++first) {
+                init = op(init, *first);
+            }
+            return init;
+        }
+
+        template < class RandomAccessIterator, class T, class BinaryOperation >
+        T reduce_impl(RandomAccessIterator first, RandomAccessIterator last, T init,
+                    BinaryOperation op, ft::true_type) {
+            std::size_t n = last - first;
+            if (n < sequential_threshold()) {
+                return ft::parallel::reduce_impl(first, last, init, op, ft::false_type());
+            }
+            if (n == 0) {
+                return init;
+            }
+            reduce_task< RandomAccessIterator, T, BinaryOperation > task(first, n, init, op);
+            task.start();
+            for (std::size_t i = 0; i < task.chunks; ++i) {
+                if (task.chunk_begin(i) != task.chunk_end(i)) {
+                    init = op(init, task.partials[i]);
+                }
+            }
+            return init;
+        }
+
+        /**
+         * @brief Réduit [first, last) avec op, à partir de init. op doit être
+         * associative : les éléments sont regroupés par blocs, dans leur
+         * ordre, mais pas un par un de gauche à droite : pour des flottants,
+         * le résultat peut différer légèrement de celui d'une boucle.
+         */
+        template < class InputIterator, class T, class BinaryOperation >
+        T reduce(InputIterator first, InputIterator last, T init, BinaryOperation op) {
+            return ft::parallel::reduce_impl(first, last, init, op,
+                                            is_random_access< InputIterator >());
+        }
+
+        template < class InputIterator, class T >
+        T reduce(InputIterator first, InputIterator last, T init) {
+            return ft::parallel::reduce(first, last, init, plus());
+        }
+
+        /* count_if ------------------------------------------------------- */
+
+        template < class RandomAccessIterator, class UnaryPredicate >
+        struct count_if_task : public chunked_task {
+            RandomAccessIterator first;
+            UnaryPredicate pred;
+            ft::vector< std::size_t > counts;
+
+            count_if_task(RandomAccessIterator first, std::size_t n, UnaryPredicate pred)
+                : chunked_task(n), first(first), pred(pred), counts(this->chunks, 0) {}
+
+            void run(std::size_t i) {
+                UnaryPredicate local(this->pred);
+                RandomAccessIterator it = this->first + this->chunk_begin(i);
+                RandomAccessIterator end = this->first + this->chunk_end(i);
+                std::size_t count = 0;
+                for (; it != end; ++it) {
+                    if (local(*it)) {
+                        ++count;
+                    }
+                }
+                this->counts[i] = count;
+            }
+        };
+
+        template < class InputIterator, class UnaryPredicate >
+        typename ft::iterator_traits< InputIterator >::difference_type count_if_impl(
+            InputIterator first, InputIterator last, UnaryPredicate pred, ft::false_type) {
+            typename ft::iterator_traits< InputIterator >::difference_type count = 0;
+            for (; first != last; ++first) {
+                if (pred(*first)) {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        template < class RandomAccessIterator, class UnaryPredicate >
+        typename ft::iterator_traits< RandomAccessIterator >::difference_type count_if_impl(
+            RandomAccessIterator first, RandomAccessIterator last, UnaryPredicate pred,
+            ft::true_type) {
+            std::size_t n = last - first;
+            if (n < sequential_threshold()) {
+                return ft::parallel::count_if_impl(first, last, pred, ft::false_type());
+            }
+            count_if_task< RandomAccessIterator, UnaryPredicate > task(first, n, pred);
+            task.start();
+            typename ft::iterator_traits< RandomAccessIterator >::difference_type count = 0;
+            for (std::size_t i = 0; i < task.chunks; ++i) {
+                count += task.counts[i];
+            }
+            return count;
+        }
+
+        /**
+         * @brief Nombre d'éléments x de [first, last) tels que pred(x).
+         */
+        template < class InputIterator, class UnaryPredicate >
+        typename ft::iterator_traits< InputIterator >::difference_type count_if(
+            InputIterator first, InputIterator last, UnaryPredicate pred) {
+            return ft::parallel::count_if_impl(first, last, pred,
+                                            is_random_access< InputIterator >());
+        }
+    }
+}
+
+#endif
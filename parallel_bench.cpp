@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_bench.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "algorithm.hpp"
+#include "parallel.hpp"
+#include "vector.hpp"
+
+#include <iostream>
+
+#include "bench.hpp"
+
+namespace {
+    const std::size_t ELEMENT_COUNT = std::size_t(1) << 25;
+    const int ROUNDS = 5;
+
+    struct scale {
+        unsigned long operator()(unsigned long x) const { return x * 3 + 1; }
+    };
+
+    struct is_odd {
+        bool operator()(unsigned long x) const { return x & 1; }
+    };
+
+    typedef ft::vector< unsigned long >::iterator iterator;
+
+    /**
+     * @brief Meilleur temps sur ROUNDS tours d'un cas, en ms.
+     */
+    template < class Case >
+    double best_ms(Case c) {
+        double best = 0;
+        for (int i = 0; i < ROUNDS; ++i) {
+            double start = bench::now_ns();
+            c();
+            double elapsed = (bench::now_ns() - start) / 1e6;
+            best = (i == 0 || elapsed < best) ? elapsed : best;
+        }
+        return best;
+    }
+
+    struct bench_data {
+        ft::vector< unsigned long > a;
+        ft::vector< unsigned long > b;
+        ft::vector< unsigned long > out;
+        unsigned long sink;
+    };
+
+    /**
+     * @brief Un cas mesuré : l'algorithme, en version séquentielle
+     * (Parallel = false) ou ft::parallel.
+     */
+    template < bool Parallel >
+    struct equal_case {
+        bench_data* d;
+
+        void operator()() const {
+            bench_data& data = *this->d;
+            if (Parallel) {
+                data.sink += ft::parallel::equal(data.a.begin(), data.a.end(), data.b.begin());
+                return;
+            }
+            data.sink += ft::equal(data.a.begin(), data.a.end(), data.b.begin());
+        }
+    };
+
+    template < bool Parallel >
+    struct reduce_case {
+        bench_data* d;
+
+        void operator()() const {
+            bench_data& data = *this->d;
+            if (Parallel) {
+                data.sink += ft::parallel::reduce(data.a.begin(), data.a.end(), 0UL);
+                return;
+            }
+            unsigned long sum = 0;
+            for (iterator it = data.a.begin(); it != data.a.end(); ++it) {
+                sum += *it;
+            }
+            data.sink += sum;
+        }
+    };
+
+    template < bool Parallel >
+    struct count_if_case {
+        bench_data* d;
+
+        void operator()() const {
+            bench_data& data = *this->d;
+            if (Parallel) {
+                data.sink += ft::parallel::count_if(data.a.begin(), data.a.end(), is_odd());
+                return;
+            }
+            is_odd pred;
+            unsigned long count = 0;
+            for (iterator it = data.a.begin(); it != data.a.end(); ++it) {
+                count += pred(*it);
+            }
+            data.sink += count;
+        }
+    };
+
+    template < bool Parallel >
+    struct transform_case {
+        bench_data* d;
+
+        void operator()() const {
+            bench_data& data = *this->d;
+            if (Parallel) {
+                ft::parallel::transform(data.a.begin(), data.a.end(), data.out.begin(), scale());
+                return;
+            }
+            scale op;
+            iterator out = data.out.begin();
+            for (iterator it = data.a.begin(); it != data.a.end(); ++it, ++out) {
+                *out = op(*it);
+            }
+        }
+    };
+
+    template < template < bool > class Case >
+    void report(const char* name, bench_data& d) {
+        Case< false > sequential = {&d};
+        Case< true > parallel = {&d};
+        double sequential_ms = best_ms(sequential);
+        double parallel_ms = best_ms(parallel);
+        std::cout << "\t " << name << ": sequential " << sequential_ms << " ms, ft::parallel "
+                << parallel_ms << " ms (x" << sequential_ms / parallel_ms << ")" << std::endl;
+    }
+}
+
+/**
+ * @brief Comparaisons et réductions sur deux vecteurs de ELEMENT_COUNT
+ * entiers de 8 octets égaux : boucle séquentielle (ou ft::equal) face à
+ * ft::parallel sur le groupe de threads par défaut.
+ */
+void bench_parallel(void) {
+    bench_data d;
+    d.sink = 0;
+    bench::lcg rng(42);
+    for (std::size_t i = 0; i < ELEMENT_COUNT; ++i) {
+        d.a.push_back(rng.next(ELEMENT_COUNT));
+    }
+    d.b = d.a;
+    d.out.resize(ELEMENT_COUNT);
+
+    std::cout << "Bench: parallel, " << ELEMENT_COUNT << " unsigned long on "
+            << ft::parallel::default_pool().size() << " threads" << std::endl;
+    report< equal_case >("equal", d);
+    report< reduce_case >("reduce", d);
+    report< count_if_case >("count_if", d);
+    report< transform_case >("transform", d);
+    if (d.sink == 1) {
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,204 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_test.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "parallel.hpp"
+#include "thread_pool.hpp"
+#include "vector.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Compte, pour chaque indice, le nombre d'exécutions.
+     */
+    struct counting_task : public ft::thread_pool::task {
+        ft::vector< int > runs;
+
+        explicit counting_task(std::size_t n) : runs(n, 0) {}
+
+        void run(std::size_t index) { ++this->runs[index]; }
+    };
+
+    struct nested_task : public ft::thread_pool::task {
+        ft::thread_pool* pool;
+        ft::vector< int > inner_runs;
+
+        explicit nested_task(ft::thread_pool& pool) : pool(&pool), inner_runs(8, 0) {}
+
+        void run(std::size_t index) {
+            counting_task inner(10);
+            this->pool->run(inner, 10);
+            int total = 0;
+            for (std::size_t i = 0; i < inner.runs.size(); ++i) {
+                total += inner.runs[i];
+            }
+            this->inner_runs[index] = total;
+        }
+    };
+
+    struct throwing_task : public ft::thread_pool::task {
+        void run(std::size_t index) {
+            if (index == 5) {
+                throw std::logic_error("chunk 5");
+            }
+        }
+    };
+
+    struct increment {
+        void operator()(int& x) const { ++x; }
+    };
+
+    struct half {
+        double operator()(int x) const { return x / 2.0; }
+    };
+
+    struct multiply {
+        long operator()(int x, long y) const { return x * y; }
+    };
+
+    struct maximum {
+        int operator()(int x, int y) const { return x < y ? y : x; }
+    };
+
+    struct is_multiple_of_three {
+        bool operator()(int x) const { return x % 3 == 0; }
+    };
+
+    struct same_parity {
+        bool operator()(int x, int y) const { return (x - y) % 2 == 0; }
+    };
+}
+
+void test_parallel(void) {
+    std::cout << "Test: parallel" << std::endl;
+
+    std::cout << "\t thread_pool" << std::endl;
+    {
+        ft::thread_pool pool(4);
+        assert(pool.size() == 4);
+        for (int round = 0; round < 50; ++round) {
+            counting_task task(97);
+            pool.run(task, 97);
+            for (std::size_t i = 0; i < task.runs.size(); ++i) {
+                assert(task.runs[i] == 1);
+            }
+        }
+        /* Un run() depuis une tâche s'exécute sur place au lieu d'attendre */
+        nested_task nested(pool);
+        pool.run(nested, 8);
+        for (std::size_t i = 0; i < nested.inner_runs.size(); ++i) {
+            assert(nested.inner_runs[i] == 10);
+        }
+        throwing_task failing;
+        bool thrown = false;
+        try {
+            pool.run(failing, 16);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        counting_task after(3);
+        pool.run(after, 3);
+        assert(after.runs[0] == 1 && after.runs[1] == 1 && after.runs[2] == 1);
+
+        ft::thread_pool single(1);
+        counting_task alone(5);
+        single.run(alone, 5);
+        assert(single.size() == 1 && alone.runs[4] == 1);
+    }
+
+    std::size_t default_threshold = ft::parallel::sequential_threshold();
+    assert(default_threshold == ft::parallel::DEFAULT_SEQUENTIAL_THRESHOLD);
+    /* Seuil bas pour découper même les petits intervalles du test */
+    ft::parallel::set_sequential_threshold(16);
+
+    std::cout << "\t for_each / transform" << std::endl;
+    ft::vector< int > v;
+    for (int i = 0; i < 100003; ++i) {
+        v.push_back(i);
+    }
+    ft::parallel::for_each(v.begin(), v.end(), increment());
+    for (int i = 0; i < 100003; ++i) {
+        assert(v[i] == i + 1);
+    }
+    ft::vector< double > halves(v.size());
+    ft::vector< double >::iterator halves_end =
+        ft::parallel::transform(v.begin(), v.end(), halves.begin(), half());
+    assert(halves_end == halves.end() && halves[0] == 0.5 && halves[100002] == 100003 / 2.0);
+    ft::vector< long > weights(v.size(), 3);
+    ft::vector< long > products(v.size());
+    ft::parallel::transform(v.begin(), v.end(), weights.begin(), products.begin(), multiply());
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        assert(products[i] == 3L * v[i]);
+    }
+    int small[5] = {1, 2, 3, 4, 5};
+    ft::parallel::for_each(small, small + 5, increment());
+    assert(small[0] == 2 && small[4] == 6);
+
+    std::cout << "\t equal / mismatch" << std::endl;
+    ft::vector< int > w(v);
+    assert(ft::parallel::equal(v.begin(), v.end(), w.begin()));
+    assert(ft::parallel::mismatch(v.begin(), v.end(), w.begin()).first == v.end());
+    std::size_t positions[] = {0, 17, 50000, 65536, 100002};
+    for (std::size_t p = 0; p < sizeof(positions) / sizeof(*positions); ++p) {
+        std::size_t at = positions[p];
+        w[at] = -1;
+        w[100002 - at / 2] = -2;
+        assert(!ft::parallel::equal(v.begin(), v.end(), w.begin()));
+        ft::pair< ft::vector< int >::iterator, ft::vector< int >::iterator > found =
+            ft::parallel::mismatch(v.begin(), v.end(), w.begin());
+        std::size_t expected = at < 100002 - at / 2 ? at : 100002 - at / 2;
+        assert(found.first == v.begin() + expected && found.second == w.begin() + expected);
+        w[at] = v[at];
+        w[100002 - at / 2] = v[100002 - at / 2];
+    }
+    w[1000] += 2;
+    assert(!ft::parallel::equal(v.begin(), v.end(), w.begin()));
+    assert(ft::parallel::equal(v.begin(), v.end(), w.begin(), same_parity()));
+    w[999] += 1;
+    assert(ft::parallel::mismatch(v.begin(), v.end(), w.begin(), same_parity()).first ==
+        v.begin() + 999);
+    assert(ft::parallel::equal(v.begin(), v.begin(), w.begin()));
+    assert(ft::parallel::equal(&v[0], &v[0] + 999, &w[0]));
+
+    std::cout << "\t reduce / count_if" << std::endl;
+    unsigned long sum = ft::parallel::reduce(v.begin(), v.end(), 0UL);
+    assert(sum == 100003UL * 100004UL / 2);
+    assert(ft::parallel::reduce(v.begin(), v.end(), 1000000, maximum()) == 1000000);
+    assert(ft::parallel::reduce(v.begin(), v.end(), -5, maximum()) == 100003);
+    assert(ft::parallel::reduce(v.begin(), v.begin(), 42) == 42);
+    assert(ft::parallel::count_if(v.begin(), v.end(), is_multiple_of_three()) == 100003 / 3);
+    assert(ft::parallel::count_if(v.begin(), v.begin() + 3, is_multiple_of_three()) == 1);
+
+    /* Seuil nul : un intervalle vide ne lit aucun élément */
+    ft::parallel::set_sequential_threshold(0);
+    assert(ft::parallel::reduce(v.begin(), v.begin(), 42) == 42);
+    assert(ft::parallel::reduce(v.begin(), v.begin() + 1, 42) == 43);
+    assert(ft::parallel::count_if(v.begin(), v.begin(), is_multiple_of_three()) == 0);
+    ft::parallel::for_each(v.end(), v.end(), increment());
+    assert(ft::parallel::equal(v.end(), v.end(), w.end()));
+    ft::parallel::set_sequential_threshold(16);
+
+    /* Itérateurs d'entrée : exécution séquentielle */
+    std::istringstream numbers("1 2 3 4 5 6");
+    assert(ft::parallel::reduce(std::istream_iterator< int >(numbers),
+                                std::istream_iterator< int >(), 0) == 21);
+
+    /* Sous le seuil : même résultat, sans passer par le groupe */
+    ft::parallel::set_sequential_threshold(default_threshold);
+    assert(ft::parallel::count_if(v.begin(), v.begin() + 100, is_multiple_of_three()) == 33);
+    assert(ft::parallel::reduce(v.begin(), v.end(), 0UL) == sum);
+}
@@ -0,0 +1,380 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_allocator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _POOL_ALLOCATOR_HPP_
+#define _POOL_ALLOCATOR_HPP_
+
+#include <pthread.h>
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+#include "util.hpp"
+
+#ifdef FT_CONTAINERS_CXX11
+#define FT_POOL_THREAD_LOCAL thread_local
+#else
+#define FT_POOL_THREAD_LOCAL __thread
+#endif
+
+namespace ft {
+    namespace pool {
+
+        /* Plus petit bloc servi, en octets */
+        static const std::size_t MIN_BLOCK = 16;
+        /* Nombre de classes de taille : 16, 32, ..., 4096 octets */
+        static const std::size_t CLASS_COUNT = 9;
+        /* Plus grand bloc servi ; au-delà, l'allocation passe par operator new */
+        static const std::size_t MAX_BLOCK = MIN_BLOCK << (CLASS_COUNT - 1);
+        /* Taille des blocs de mémoire découpés pour remplir une liste libre */
+        static const std::size_t CHUNK_SIZE = 64 * 1024;
+
+        /**
+         * @brief Renvoie l'indice de la plus petite classe de taille qui peut
+         * contenir bytes octets, bytes étant au plus MAX_BLOCK.
+         */
+        inline std::size_t size_class(std::size_t bytes) {
+            std::size_t index = 0;
+            std::size_t block = MIN_BLOCK;
+            while (block < bytes) {
+                block <<= 1;
+                ++index;
+            }
+            return index;
+        }
+
+        /**
+         * @brief Bloc libre, chaîné dans la liste de sa classe de taille.
+         */
+        struct free_block {
+            free_block* next;
+        };
+
+        /**
+         * @brief En-tête d'un bloc de CHUNK_SIZE octets obtenu d'operator new,
+         * chaîné pour que la mémoire reste référencée.
+         */
+        struct chunk {
+            chunk* next;
+        };
+
+        /**
+         * @brief Dépôt central, protégé par un mutex : il recueille les listes
+         * libres et les chunks des threads terminés, que les autres threads
+         * reprennent avant de découper de nouveaux chunks.
+         */
+        struct depot {
+            pthread_mutex_t mutex;
+            free_block* free_lists[CLASS_COUNT];
+            chunk* chunks;
+        };
+
+        inline depot& central_depot(void) {
+            static depot instance = {PTHREAD_MUTEX_INITIALIZER, {u_nullptr}, u_nullptr};
+            return instance;
+        }
+
+        struct thread_cache;
+
+        inline void register_thread_exit(thread_cache* cache);
+
+        /**
+         * @brief Nombre de blocs de la classe index découpés dans un chunk.
+         */
+        inline std::size_t blocks_per_chunk(std::size_t index) {
+            return (CHUNK_SIZE - MIN_BLOCK) / (MIN_BLOCK << index);
+        }
+
+        /**
+         * @brief Cache propre à un thread : une liste libre par classe de taille.
+         * Un bloc est toujours rendu à la liste du thread qui le libère, sans
+         * verrou ; un bloc alloué par un thread peut donc être réutilisé par un
+         * autre. Une liste ne garde pas plus de deux chunks de blocs : au-delà,
+         * l'excédent passe au dépôt central, où les threads qui allouent le
+         * reprennent (producteur et consommateur sur deux threads). Quand le
+         * thread se termine, ses listes et ses chunks passent au dépôt
+         * central ; les chunks ne sont jamais rendus au système.
+         * La structure est un agrégat pour pouvoir être thread-local et
+         * initialisée à zéro sans constructeur.
+         */
+        struct thread_cache {
+            free_block* free_lists[CLASS_COUNT];
+            std::size_t counts[CLASS_COUNT];
+            chunk* chunks;
+            bool registered;
+
+            void* allocate(std::size_t index) {
+                free_block* block = this->free_lists[index];
+                if (!block) {
+                    block = this->_refill(index);
+                }
+                this->free_lists[index] = block->next;
+                --this->counts[index];
+                return block;
+            }
+
+            void deallocate(void* p, std::size_t index) {
+                free_block* block = static_cast< free_block* >(p);
+                block->next = this->free_lists[index];
+                this->free_lists[index] = block;
+                if (++this->counts[index] > 2 * blocks_per_chunk(index)) {
+                    this->_spill(index);
+                }
+            }
+
+            /**
+             * @brief Transfère les listes libres et les chunks au dépôt central.
+             */
+            void release_to_depot(void) {
+                depot& central = central_depot();
+                pthread_mutex_lock(&central.mutex);
+                for (std::size_t index = 0; index < CLASS_COUNT; ++index) {
+                    free_block* head = this->free_lists[index];
+                    if (!head) {
+                        continue;
+                    }
+                    free_block* tail = head;
+                    while (tail->next) {
+                        tail = tail->next;
+                    }
+                    tail->next = central.free_lists[index];
+                    central.free_lists[index] = head;
+                    this->free_lists[index] = u_nullptr;
+                    this->counts[index] = 0;
+                }
+                while (this->chunks) {
+                    chunk* next = this->chunks->next;
+                    this->chunks->next = central.chunks;
+                    central.chunks = this->chunks;
+                    this->chunks = next;
+                }
+                pthread_mutex_unlock(&central.mutex);
+                this->registered = false;
+            }
+
+        private:
+            /**
+             * @brief Garde blocks_per_chunk(index) blocs dans la liste de la
+             * classe index et chaîne les autres en tête de celle du dépôt.
+             */
+            void _spill(std::size_t index) {
+                std::size_t kept = blocks_per_chunk(index);
+                free_block* last_kept = this->free_lists[index];
+                for (std::size_t i = 1; i < kept; ++i) {
+                    last_kept = last_kept->next;
+                }
+                free_block* head = last_kept->next;
+                free_block* tail = head;
+                while (tail->next) {
+                    tail = tail->next;
+                }
+                last_kept->next = u_nullptr;
+                this->counts[index] = kept;
+
+                depot& central = central_depot();
+                pthread_mutex_lock(&central.mutex);
+                tail->next = central.free_lists[index];
+                central.free_lists[index] = head;
+                pthread_mutex_unlock(&central.mutex);
+            }
+
+            /**
+             * @brief Reprend au plus un chunk de blocs de la liste libre de la
+             * classe index du dépôt central si elle n'est pas vide, sinon
+             * découpe un nouveau chunk en blocs de cette classe.
+             */
+            free_block* _refill(std::size_t index) {
+                if (!this->registered) {
+                    register_thread_exit(this);
+                    this->registered = true;
+                }
+
+                depot& central = central_depot();
+                pthread_mutex_lock(&central.mutex);
+                free_block* adopted = central.free_lists[index];
+                std::size_t count = 0;
+                if (adopted) {
+                    free_block* last = adopted;
+                    for (count = 1; count < blocks_per_chunk(index) && last->next; ++count) {
+                        last = last->next;
+                    }
+                    central.free_lists[index] = last->next;
+                    last->next = u_nullptr;
+                }
+                pthread_mutex_unlock(&central.mutex);
+                if (adopted) {
+                    this->counts[index] = count;
+                    return adopted;
+                }
+
+                const std::size_t block_size = MIN_BLOCK << index;
+                char* raw = static_cast< char* >(::operator new(CHUNK_SIZE));
+                chunk* header = reinterpret_cast< chunk* >(raw);
+                header->next = this->chunks;
+                this->chunks = header;
+
+                /* le premier bloc est réservé à l'en-tête, aligné sur MIN_BLOCK */
+                char* first = raw + MIN_BLOCK;
+                count = blocks_per_chunk(index);
+                free_block* head = u_nullptr;
+                for (std::size_t i = count; i-- > 0;) {
+                    free_block* block = reinterpret_cast< free_block* >(first + i * block_size);
+                    block->next = head;
+                    head = block;
+                }
+                this->counts[index] = count;
+                return head;
+            }
+        };
+
+        inline void release_thread_cache(void* cache) {
+            static_cast< thread_cache* >(cache)->release_to_depot();
+        }
+
+        inline pthread_key_t& thread_exit_key(void) {
+            static pthread_key_t key;
+            return key;
+        }
+
+        inline void create_thread_exit_key(void) {
+            pthread_key_create(&thread_exit_key(), release_thread_cache);
+        }
+
+        /**
+         * @brief Associe le cache au thread appelant pour que
+         * release_thread_cache soit appelé à sa terminaison.
+         * Le thread principal n'est pas concerné : son cache vit jusqu'à la
+         * fin du processus.
+         */
+        inline void register_thread_exit(thread_cache* cache) {
+            static pthread_once_t once = PTHREAD_ONCE_INIT;
+            pthread_once(&once, create_thread_exit_key);
+            pthread_setspecific(thread_exit_key(), cache);
+        }
+
+        /**
+         * @brief Cache du thread appelant.
+         */
+        inline thread_cache& local_cache(void) {
+            static FT_POOL_THREAD_LOCAL thread_cache cache;
+            return cache;
+        }
+
+        /**
+         * @brief Alloue bytes octets depuis le cache du thread appelant, ou
+         * depuis operator new au-delà de MAX_BLOCK.
+         */
+        inline void* allocate(std::size_t bytes) {
+            if (bytes > MAX_BLOCK) {
+                return ::operator new(bytes);
+            }
+            return local_cache().allocate(size_class(bytes));
+        }
+
+        /**
+         * @brief Libère un bloc obtenu par allocate(bytes), avec la même taille.
+         */
+        inline void deallocate(void* p, std::size_t bytes) {
+            if (!p) {
+                return;
+            }
+            if (bytes > MAX_BLOCK) {
+                ::operator delete(p);
+                return;
+            }
+            local_cache().deallocate(p, size_class(bytes));
+        }
+    }
+
+    /**
+     * @brief Allocateur à classes de taille : les demandes d'au plus
+     * pool::MAX_BLOCK octets sont servies par les listes libres du thread
+     * appelant, sans verrou ni appel système, les plus grandes par
+     * operator new. Sans état, toutes ses instances sont interchangeables ;
+     * il s'utilise comme _Alloc de ft::vector.
+     *
+     * @tparam T Type des éléments alloués.
+     */
+    template < class T >
+    class pool_allocator {
+        public:
+            typedef T value_type;
+            typedef T* pointer;
+            typedef const T* const_pointer;
+            typedef T& reference;
+            typedef const T& const_reference;
+            typedef std::size_t size_type;
+            typedef std::ptrdiff_t difference_type;
+
+            template < class U >
+            struct rebind {
+                typedef pool_allocator< U > other;
+            };
+
+            pool_allocator() {}
+
+            pool_allocator(const pool_allocator&) {}
+
+            template < class U >
+            pool_allocator(const pool_allocator< U >&) {}
+
+            ~pool_allocator() {}
+
+            pool_allocator& operator=(const pool_allocator&) { return *this; }
+
+            pointer address(reference x) const { return &x; }
+
+            const_pointer address(const_reference x) const { return &x; }
+
+            pointer allocate(size_type n, const void* = 0) {
+                if (n > this->max_size()) {
+                    throw std::bad_alloc();
+                }
+                return static_cast< pointer >(pool::allocate(n * sizeof(T)));
+            }
+
+            void deallocate(pointer p, size_type n) { pool::deallocate(p, n * sizeof(T)); }
+
+            size_type max_size() const {
+                return std::numeric_limits< size_type >::max() / sizeof(T);
+            }
+
+#ifdef FT_CONTAINERS_CXX11
+            template < class U, class... Args >
+            void construct(U* p, Args&&... args) {
+                ::new (static_cast< void* >(p)) U(std::forward< Args >(args)...);
+            }
+
+            template < class U >
+            void destroy(U* p) {
+                p->~U();
+            }
+#else
+            void construct(pointer p, const_reference val) { new (p) T(val); }
+
+            void destroy(pointer p) { p->~T(); }
+#endif
+    };
+
+    template < class T, class U >
+    bool operator==(const pool_allocator< T >&, const pool_allocator< U >&) {
+        return true;
+    }
+
+    template < class T, class U >
+    bool operator!=(const pool_allocator< T >&, const pool_allocator< U >&) {
+        return false;
+    }
+}
+
+#endif
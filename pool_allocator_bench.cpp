@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_allocator_bench.cpp                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "pool_allocator.hpp"
+
+#include <iostream>
+#include <memory>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+namespace {
+    const std::size_t CHURN_ROUNDS = 2000000;
+    const std::size_t LIVE_SLOTS = 1024;
+
+    /**
+     * @brief Crée et détruit un vecteur de 1 à 64 éléments par tour : chaque
+     * tour alloue puis libère aussitôt quelques blocs de tailles variées.
+     */
+    template < class Vector >
+    void bench_short_lived(const char* name) {
+        bench::lcg rng(42);
+        long checksum = 0;
+        double start = bench::now_ns();
+        for (std::size_t round = 0; round < CHURN_ROUNDS; ++round) {
+            Vector v;
+            std::size_t size = rng.next(64) + 1;
+            for (std::size_t i = 0; i < size; ++i) {
+                v.push_back(static_cast< int >(i));
+            }
+            checksum += v.back();
+        }
+        double per_round_ns = (bench::now_ns() - start) / CHURN_ROUNDS;
+        std::cout << "\t " << name << " short-lived: " << per_round_ns << " ns/round"
+                << (checksum == -1 ? " " : "") << std::endl;
+    }
+
+    /**
+     * @brief Garde LIVE_SLOTS vecteurs vivants et en remplace un au hasard à
+     * chaque tour : les libérations se font dans un ordre quelconque.
+     */
+    template < class Vector >
+    void bench_live_set(const char* name) {
+        bench::lcg rng(7);
+        Vector* slots = new Vector[LIVE_SLOTS];
+        double start = bench::now_ns();
+        for (std::size_t round = 0; round < CHURN_ROUNDS; ++round) {
+            Vector& slot = slots[rng.next(LIVE_SLOTS)];
+            Vector fresh(rng.next(256) + 1, static_cast< int >(round));
+            slot.swap(fresh);
+        }
+        double per_round_ns = (bench::now_ns() - start) / CHURN_ROUNDS;
+        delete[] slots;
+        std::cout << "\t " << name << " live set: " << per_round_ns << " ns/round"
+                << std::endl;
+    }
+}
+
+void bench_pool_allocator(void) {
+    typedef ft::vector< int, ft::pool_allocator< int > > pool_vector;
+    typedef ft::vector< int, std::allocator< int > > std_vector;
+
+    std::cout << "Bench: pool_allocator churn" << std::endl;
+    bench_short_lived< pool_vector >("ft::pool_allocator");
+    bench_short_lived< std_vector >("std::allocator");
+    bench_live_set< pool_vector >("ft::pool_allocator");
+    bench_live_set< std_vector >("std::allocator");
+}
@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_allocator_test.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "pool_allocator.hpp"
+
+#include <pthread.h>
+
+#include <cassert>
+#include <iostream>
+#include <string>
+#ifdef FT_CONTAINERS_CXX11
+#include <memory>
+#endif
+
+#include "vector.hpp"
+
+namespace {
+    void* cache_of_thread(void*) {
+        /* un bloc libéré ici rejoint le cache de ce thread, pas celui de main */
+        void* p = ft::pool::allocate(2048);
+        ft::pool::deallocate(p, 2048);
+        return &ft::pool::local_cache();
+    }
+
+    const std::size_t CHURN_BLOCKS = 1000;
+    const int CHURN_ROUNDS = 200;
+
+    /**
+     * @brief Passage de blocs entre un thread qui alloue et le thread
+     * principal qui les libère, tour à tour.
+     */
+    struct churn {
+        pthread_mutex_t mutex;
+        pthread_cond_t turn_changed;
+        bool producer_turn;
+        void* blocks[CHURN_BLOCKS];
+    };
+
+    std::size_t chunk_count(const ft::pool::thread_cache& cache) {
+        std::size_t count = 0;
+        for (ft::pool::chunk* c = cache.chunks; c; c = c->next) {
+            ++count;
+        }
+        return count;
+    }
+
+    void* produce(void* arg) {
+        churn* shared = static_cast< churn* >(arg);
+        for (int round = 0; round < CHURN_ROUNDS; ++round) {
+            pthread_mutex_lock(&shared->mutex);
+            while (!shared->producer_turn) {
+                pthread_cond_wait(&shared->turn_changed, &shared->mutex);
+            }
+            for (std::size_t i = 0; i < CHURN_BLOCKS; ++i) {
+                shared->blocks[i] = ft::pool::allocate(256);
+            }
+            shared->producer_turn = false;
+            pthread_cond_signal(&shared->turn_changed);
+            pthread_mutex_unlock(&shared->mutex);
+        }
+        return reinterpret_cast< void* >(chunk_count(ft::pool::local_cache()));
+    }
+
+#ifdef FT_CONTAINERS_CXX11
+    struct copy_counted {
+        static int copies;
+        int value;
+        explicit copy_counted(int v) : value(v) {}
+        copy_counted(const copy_counted& other) : value(other.value) { ++copies; }
+        copy_counted(copy_counted&& other) noexcept : value(other.value) {}
+    };
+    int copy_counted::copies = 0;
+#endif
+}
+
+void test_pool_allocator(void) {
+    std::cout << "Test: pool_allocator" << std::endl;
+
+    assert(ft::pool::size_class(1) == 0 && ft::pool::size_class(16) == 0);
+    assert(ft::pool::size_class(17) == 1 && ft::pool::size_class(ft::pool::MAX_BLOCK) == 8);
+
+    ft::pool_allocator< int > alloc;
+    int* first = alloc.allocate(10);
+    alloc.deallocate(first, 10);
+    int* reused = alloc.allocate(12);
+    assert(reused == first);
+    int* other = alloc.allocate(12);
+    assert(other != reused);
+    alloc.deallocate(other, 12);
+    alloc.deallocate(reused, 12);
+
+    ft::pool_allocator< std::string > rebound(alloc);
+    assert(rebound == alloc);
+    std::string* large = rebound.allocate(ft::pool::MAX_BLOCK);
+    rebound.deallocate(large, ft::pool::MAX_BLOCK);
+
+    ft::vector< std::string, ft::pool_allocator< std::string > > strings;
+    for (int i = 0; i < 1000; ++i) {
+        strings.push_back(std::string(static_cast< size_t >(i % 50), 'p'));
+    }
+    strings.erase(strings.begin(), strings.begin() + 500);
+    assert(strings.size() == 500 && strings[0].size() == 0 && strings[1].size() == 1);
+
+    pthread_t thread;
+    void* thread_cache = ft::u_nullptr;
+    assert(pthread_create(&thread, ft::u_nullptr, cache_of_thread, ft::u_nullptr) == 0);
+    assert(pthread_join(thread, &thread_cache) == 0);
+    assert(thread_cache != &ft::pool::local_cache());
+
+    /* à sa terminaison, le thread a laissé ses blocs au dépôt central */
+    ft::pool::depot& central = ft::pool::central_depot();
+    assert(central.chunks != ft::u_nullptr);
+    assert(central.free_lists[ft::pool::size_class(2048)] != ft::u_nullptr);
+    void* blocks[64];
+    for (int i = 0; i < 64; ++i) {
+        blocks[i] = ft::pool::allocate(2048);
+    }
+    assert(central.free_lists[ft::pool::size_class(2048)] == ft::u_nullptr);
+    for (int i = 0; i < 64; ++i) {
+        ft::pool::deallocate(blocks[i], 2048);
+    }
+
+    /* Producteur et consommateur : les blocs libérés par le thread principal
+       reviennent au producteur par le dépôt, qui ne découpe que peu de chunks */
+    churn shared;
+    pthread_mutex_init(&shared.mutex, ft::u_nullptr);
+    pthread_cond_init(&shared.turn_changed, ft::u_nullptr);
+    shared.producer_turn = true;
+    pthread_t producer;
+    assert(pthread_create(&producer, ft::u_nullptr, produce, &shared) == 0);
+    for (int round = 0; round < CHURN_ROUNDS; ++round) {
+        pthread_mutex_lock(&shared.mutex);
+        while (shared.producer_turn) {
+            pthread_cond_wait(&shared.turn_changed, &shared.mutex);
+        }
+        for (std::size_t i = 0; i < CHURN_BLOCKS; ++i) {
+            ft::pool::deallocate(shared.blocks[i], 256);
+        }
+        std::size_t index = ft::pool::size_class(256);
+        assert(ft::pool::local_cache().counts[index] <= 2 * ft::pool::blocks_per_chunk(index));
+        shared.producer_turn = true;
+        pthread_cond_signal(&shared.turn_changed);
+        pthread_mutex_unlock(&shared.mutex);
+    }
+    void* producer_chunks = ft::u_nullptr;
+    assert(pthread_join(producer, &producer_chunks) == 0);
+    /* sans plafond, 200 tours de 1000 blocs de 256 octets découpent 785 chunks */
+    assert(reinterpret_cast< std::size_t >(producer_chunks) <= 16);
+    pthread_cond_destroy(&shared.turn_changed);
+    pthread_mutex_destroy(&shared.mutex);
+
+#ifdef FT_CONTAINERS_CXX11
+    /* construct transmet ses arguments : emplace et croissance déplacent */
+    ft::vector< copy_counted, ft::pool_allocator< copy_counted > > counted;
+    for (int i = 0; i < 100; ++i) {
+        counted.emplace_back(i);
+        counted.push_back(copy_counted(i));
+    }
+    assert(copy_counted::copies == 0 && counted.size() == 200 && counted[199].value == 99);
+
+    ft::vector< std::unique_ptr< int >, ft::pool_allocator< std::unique_ptr< int > > > owners;
+    for (int i = 0; i < 50; ++i) {
+        owners.emplace_back(new int(i));
+    }
+    owners.insert(owners.begin(), std::unique_ptr< int >(new int(-1)));
+    owners.erase(owners.begin() + 1);
+    assert(owners.size() == 50 && *owners[0] == -1 && *owners[49] == 49);
+#endif
+}
@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   queue.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _QUEUE_HPP_
+#define _QUEUE_HPP_
+
+#include "algorithm.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft {
+    /**
+     * @brief Adaptateur de conteneur FIFO : les éléments sont insérés à
+     * l'arrière et retirés à l'avant.
+     * Le conteneur par défaut est un ft::vector, dont l'effacement en tête
+     * coûte O(n) : pop avance donc seulement un indice de tête, et les
+     * éléments retirés sont détruits par lots, en un seul erase, dès qu'ils
+     * occupent la moitié du conteneur ou que la file devient vide. pop
+     * reste ainsi en O(1) amorti, mais la destruction d'un élément retiré
+     * peut être différée jusqu'à ce compactage.
+     *
+     * @tparam T Type des éléments.
+     * @tparam Container Conteneur sous-jacent à accès aléatoire, avec
+     * push_back, clear et insert / erase d'intervalle, par défaut
+     * `ft::vector<T>`.
+     */
+    template < class T, class Container = ft::vector< T > >
+    class queue {
+        public:
+            /* Le deuxième paramètre du template (Container) */
+            typedef Container container_type;
+            typedef typename container_type::value_type value_type;
+            typedef typename container_type::size_type size_type;
+            typedef typename container_type::reference reference;
+            typedef typename container_type::const_reference const_reference;
+
+        protected:
+            container_type c;
+            /* Nombre d'éléments déjà retirés en tête de c */
+            size_type _head;
+
+        public:
+            /**
+             * @brief constructeur à partir d'une copie de ctnr
+             */
+            explicit queue(const container_type& ctnr = container_type()) : c(ctnr), _head(0) {}
+
+            bool empty() const { return this->size() == 0; }
+
+            size_type size() const { return this->c.size() - this->_head; }
+
+            reference front() { return this->c[this->_head]; }
+
+            const_reference front() const { return this->c[this->_head]; }
+
+            reference back() { return this->c.back(); }
+
+            const_reference back() const { return this->c.back(); }
+
+            void push(const value_type& val) { this->c.push_back(val); }
+
+#ifdef FT_CONTAINERS_CXX11
+            void push(value_type&& val) { this->c.push_back(std::move(val)); }
+
+            template < class... Args >
+            void emplace(Args&&... args) {
+                this->c.emplace_back(std::forward< Args >(args)...);
+            }
+#endif
+
+            void pop() { this->pop_n(1); }
+
+            /**
+             * @brief Enfile les éléments de [first, last) dans l'ordre. Pour
+             * des itérateurs multi-passes, le conteneur grandit au plus une fois.
+             */
+            template < class InputIterator >
+            void push_range(InputIterator first, InputIterator last) {
+                this->c.insert(this->c.end(), first, last);
+            }
+
+            /**
+             * @brief Retire les n éléments de tête. n ne doit pas dépasser size().
+             */
+            void pop_n(size_type n) {
+                this->_head += n;
+                if (this->_head == this->c.size()) {
+                    this->c.clear();
+                    this->_head = 0;
+                } else if (this->_head * 2 >= this->c.size()) {
+                    this->_compact();
+                }
+            }
+
+            void swap(queue& x) {
+                this->c.swap(x.c);
+                ft::swap(this->_head, x._head);
+            }
+
+            template < class T1, class C1 >
+            friend bool operator==(const queue< T1, C1 >& lhs, const queue< T1, C1 >& rhs);
+
+            template < class T1, class C1 >
+            friend bool operator<(const queue< T1, C1 >& lhs, const queue< T1, C1 >& rhs);
+
+        private:
+            /**
+             * @brief Détruit d'un seul erase les éléments déjà retirés.
+             */
+            void _compact() {
+                this->c.erase(this->c.begin(), this->c.begin() + this->_head);
+                this->_head = 0;
+            }
+    };
+
+    template < class T, class Container >
+    bool operator==(const queue< T, Container >& lhs, const queue< T, Container >& rhs) {
+        return lhs.size() == rhs.size() &&
+            ft::equal(lhs.c.begin() + lhs._head, lhs.c.end(), rhs.c.begin() + rhs._head);
+    }
+
+    template < class T, class Container >
+    bool operator!=(const queue< T, Container >& lhs, const queue< T, Container >& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template < class T, class Container >
+    bool operator<(const queue< T, Container >& lhs, const queue< T, Container >& rhs) {
+        return ft::lexicographical_compare(lhs.c.begin() + lhs._head, lhs.c.end(),
+                                        rhs.c.begin() + rhs._head, rhs.c.end());
+    }
+
+    template < class T, class Container >
+    bool operator<=(const queue< T, Container >& lhs, const queue< T, Container >& rhs) {
+        return !(rhs < lhs);
+    }
+
+    template < class T, class Container >
+    bool operator>(const queue< T, Container >& lhs, const queue< T, Container >& rhs) {
+        return rhs < lhs;
+    }
+
+    template < class T, class Container >
+    bool operator>=(const queue< T, Container >& lhs, const queue< T, Container >& rhs) {
+        return !(lhs < rhs);
+    }
+
+    /**
+     * @brief Échanger le contenu de deux queue
+     */
+    template < class T, class Container >
+    void swap(queue< T, Container >& x, queue< T, Container >& y) {
+        x.swap(y);
+    }
+}
+
+#endif
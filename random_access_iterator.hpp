@@ -54,6 +54,14 @@ namespace ft {
             random_access_iterator(const random_access_iterator< T >& other)
                 : _ptr(other._ptr){};
 
+            /**
+             * @brief opérateur d'affectation
+             */
+            random_access_iterator& operator=(const random_access_iterator< T >& other) {
+                this->_ptr = other._ptr;
+                return *this;
+            };
+
             /**
              * @brief random_access_iterator< const T > casting operator
              *
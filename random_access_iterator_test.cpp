@@ -14,9 +14,43 @@
 
 #include <cassert>
 #include <iostream>
+#include <list>
 #include <map>
+#include <sstream>
+#include <typeinfo>
 #include <vector>
 
+void test_distance_advance(void) {
+    std::cout << "\t ft::distance / ft::advance" << std::endl;
+
+    assert((typeid(ft::iterator_category_of< std::istream_iterator< int > >::type) ==
+            typeid(ft::input_iterator_tag)));
+    assert((typeid(ft::iterator_category_of< std::list< int >::iterator >::type) ==
+            typeid(ft::bidirectional_iterator_tag)));
+    assert((typeid(ft::iterator_category_of< std::vector< int >::iterator >::type) ==
+            typeid(ft::random_access_iterator_tag)));
+    assert((typeid(ft::iterator_category_of< ft::random_access_iterator< int > >::type) ==
+            typeid(ft::random_access_iterator_tag)));
+
+    int arr[] = {1, 2, 3, 4, 5};
+    std::list< int > lst(arr, arr + 5);
+    ft::random_access_iterator< int > ft_first(arr);
+    assert(ft::distance(arr, arr + 5) == 5);
+    assert(ft::distance(ft_first, ft_first + 5) == 5);
+    assert(ft::distance(lst.begin(), lst.end()) == 5);
+    std::istringstream stream("1 2 3");
+    assert(ft::distance(std::istream_iterator< int >(stream),
+                        std::istream_iterator< int >()) == 3);
+
+    ft::advance(ft_first, 3);
+    assert(*ft_first == 4);
+    ft::advance(ft_first, -2);
+    assert(*ft_first == 2);
+    std::list< int >::iterator lit = lst.end();
+    ft::advance(lit, -1);
+    assert(*lit == 5);
+}
+
 void test_random_access_iterator(void) {
     std::cout << "Test: random_access_iterator" << std::endl;
 
@@ -87,4 +121,6 @@ void test_random_access_iterator(void) {
     std::cout << "\t while (ft_from != ft_until && std_from != "
                 "std_until) --rev_until;"
                 << std::endl;
+
+    test_distance_advance();
 }
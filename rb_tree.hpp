@@ -0,0 +1,368 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rb_tree.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _RB_TREE_HPP_
+#define _RB_TREE_HPP_
+
+#include "util.hpp"
+
+namespace ft {
+
+    enum rb_color { RB_RED, RB_BLACK };
+
+    /**
+     * @brief Partie d'un noeud d'arbre rouge-noir indépendante de la valeur.
+     * Chaque arbre possède un noeud sentinelle (header) rouge dont parent est
+     * la racine, left le plus petit noeud et right le plus grand ; la racine
+     * a le header pour parent et end() désigne le header.
+     */
+    struct rb_node_base {
+        rb_color color;
+        rb_node_base* parent;
+        rb_node_base* left;
+        rb_node_base* right;
+
+        static rb_node_base* minimum(rb_node_base* x) {
+            while (x->left) {
+                x = x->left;
+            }
+            return x;
+        }
+
+        static rb_node_base* maximum(rb_node_base* x) {
+            while (x->right) {
+                x = x->right;
+            }
+            return x;
+        }
+    };
+
+    /**
+     * @brief Noeud portant une valeur de type T.
+     */
+    template < class T >
+    struct rb_node : public rb_node_base {
+        T value;
+    };
+
+    /**
+     * @brief Initialise le header d'un arbre vide.
+     */
+    inline void rb_tree_reset(rb_node_base& header) {
+        header.color = RB_RED;
+        header.parent = u_nullptr;
+        header.left = &header;
+        header.right = &header;
+    }
+
+    /**
+     * @brief Successeur de x dans l'ordre infixe ; le successeur du plus
+     * grand noeud est le header.
+     */
+    inline rb_node_base* rb_tree_increment(rb_node_base* x) {
+        if (x->right) {
+            return rb_node_base::minimum(x->right);
+        }
+        rb_node_base* y = x->parent;
+        while (x == y->right) {
+            x = y;
+            y = y->parent;
+        }
+        /* x == header->parent->parent quand l'arbre n'a qu'un noeud */
+        if (x->right != y) {
+            x = y;
+        }
+        return x;
+    }
+
+    /**
+     * @brief Prédécesseur de x dans l'ordre infixe ; le prédécesseur du
+     * header est le plus grand noeud.
+     */
+    inline rb_node_base* rb_tree_decrement(rb_node_base* x) {
+        if (x->color == RB_RED && x->parent && x->parent->parent == x) {
+            return x->right;
+        }
+        if (x->left) {
+            return rb_node_base::maximum(x->left);
+        }
+        rb_node_base* y = x->parent;
+        while (x == y->left) {
+            x = y;
+            y = y->parent;
+        }
+        return y;
+    }
+
+    inline void rb_tree_rotate_left(rb_node_base* x, rb_node_base*& root) {
+        rb_node_base* y = x->right;
+        x->right = y->left;
+        if (y->left) {
+            y->left->parent = x;
+        }
+        y->parent = x->parent;
+        if (x == root) {
+            root = y;
+        } else if (x == x->parent->left) {
+            x->parent->left = y;
+        } else {
+            x->parent->right = y;
+        }
+        y->left = x;
+        x->parent = y;
+    }
+
+    inline void rb_tree_rotate_right(rb_node_base* x, rb_node_base*& root) {
+        rb_node_base* y = x->left;
+        x->left = y->right;
+        if (y->right) {
+            y->right->parent = x;
+        }
+        y->parent = x->parent;
+        if (x == root) {
+            root = y;
+        } else if (x == x->parent->right) {
+            x->parent->right = y;
+        } else {
+            x->parent->left = y;
+        }
+        y->right = x;
+        x->parent = y;
+    }
+
+    /**
+     * @brief Attache x comme fils gauche (insert_left) ou droit de p, met à
+     * jour le header puis rétablit les propriétés rouge-noir.
+     */
+    inline void rb_tree_insert_and_rebalance(bool insert_left, rb_node_base* x,
+                                            rb_node_base* p, rb_node_base& header) {
+        rb_node_base*& root = header.parent;
+
+        x->parent = p;
+        x->left = u_nullptr;
+        x->right = u_nullptr;
+        x->color = RB_RED;
+
+        if (insert_left) {
+            p->left = x;
+            if (p == &header) {
+                header.parent = x;
+                header.right = x;
+            } else if (p == header.left) {
+                header.left = x;
+            }
+        } else {
+            p->right = x;
+            if (p == header.right) {
+                header.right = x;
+            }
+        }
+
+        while (x != root && x->parent->color == RB_RED) {
+            rb_node_base* xpp = x->parent->parent;
+            if (x->parent == xpp->left) {
+                rb_node_base* y = xpp->right;
+                if (y && y->color == RB_RED) {
+                    x->parent->color = RB_BLACK;
+                    y->color = RB_BLACK;
+                    xpp->color = RB_RED;
+                    x = xpp;
+                } else {
+                    if (x == x->parent->right) {
+                        x = x->parent;
+                        rb_tree_rotate_left(x, root);
+                    }
+                    x->parent->color = RB_BLACK;
+                    xpp->color = RB_RED;
+                    rb_tree_rotate_right(xpp, root);
+                }
+            } else {
+                rb_node_base* y = xpp->left;
+                if (y && y->color == RB_RED) {
+                    x->parent->color = RB_BLACK;
+                    y->color = RB_BLACK;
+                    xpp->color = RB_RED;
+                    x = xpp;
+                } else {
+                    if (x == x->parent->left) {
+                        x = x->parent;
+                        rb_tree_rotate_right(x, root);
+                    }
+                    x->parent->color = RB_BLACK;
+                    xpp->color = RB_RED;
+                    rb_tree_rotate_left(xpp, root);
+                }
+            }
+        }
+        root->color = RB_BLACK;
+    }
+
+    inline bool rb_is_black(const rb_node_base* x) { return !x || x->color == RB_BLACK; }
+
+    /**
+     * @brief Détache z de l'arbre, met à jour le header et rétablit les
+     * propriétés rouge-noir. Renvoie z, que l'appelant peut alors détruire.
+     */
+    inline rb_node_base* rb_tree_rebalance_for_erase(rb_node_base* z, rb_node_base& header) {
+        rb_node_base*& root = header.parent;
+        rb_node_base*& leftmost = header.left;
+        rb_node_base*& rightmost = header.right;
+        rb_node_base* y = z;
+        rb_node_base* x = u_nullptr;
+        rb_node_base* x_parent = u_nullptr;
+
+        if (!y->left) {
+            x = y->right;
+        } else if (!y->right) {
+            x = y->left;
+        } else {
+            y = rb_node_base::minimum(y->right);
+            x = y->right;
+        }
+
+        if (y != z) {
+            /* z a deux fils : son successeur y prend sa place */
+            z->left->parent = y;
+            y->left = z->left;
+            if (y != z->right) {
+                x_parent = y->parent;
+                if (x) {
+                    x->parent = y->parent;
+                }
+                y->parent->left = x;
+                y->right = z->right;
+                z->right->parent = y;
+            } else {
+                x_parent = y;
+            }
+            if (root == z) {
+                root = y;
+            } else if (z->parent->left == z) {
+                z->parent->left = y;
+            } else {
+                z->parent->right = y;
+            }
+            y->parent = z->parent;
+            rb_color color = y->color;
+            y->color = z->color;
+            z->color = color;
+            y = z;
+        } else {
+            x_parent = y->parent;
+            if (x) {
+                x->parent = y->parent;
+            }
+            if (root == z) {
+                root = x;
+            } else if (z->parent->left == z) {
+                z->parent->left = x;
+            } else {
+                z->parent->right = x;
+            }
+            if (leftmost == z) {
+                leftmost = z->right ? rb_node_base::minimum(x) : z->parent;
+            }
+            if (rightmost == z) {
+                rightmost = z->left ? rb_node_base::maximum(x) : z->parent;
+            }
+        }
+
+        if (y->color != RB_RED) {
+            while (x != root && rb_is_black(x)) {
+                if (x == x_parent->left) {
+                    rb_node_base* w = x_parent->right;
+                    if (w->color == RB_RED) {
+                        w->color = RB_BLACK;
+                        x_parent->color = RB_RED;
+                        rb_tree_rotate_left(x_parent, root);
+                        w = x_parent->right;
+                    }
+                    if (rb_is_black(w->left) && rb_is_black(w->right)) {
+                        w->color = RB_RED;
+                        x = x_parent;
+                        x_parent = x_parent->parent;
+                    } else {
+                        if (rb_is_black(w->right)) {
+                            w->left->color = RB_BLACK;
+                            w->color = RB_RED;
+                            rb_tree_rotate_right(w, root);
+                            w = x_parent->right;
+                        }
+                        w->color = x_parent->color;
+                        x_parent->color = RB_BLACK;
+                        if (w->right) {
+                            w->right->color = RB_BLACK;
+                        }
+                        rb_tree_rotate_left(x_parent, root);
+                        break;
+                    }
+                } else {
+                    rb_node_base* w = x_parent->left;
+                    if (w->color == RB_RED) {
+                        w->color = RB_BLACK;
+                        x_parent->color = RB_RED;
+                        rb_tree_rotate_right(x_parent, root);
+                        w = x_parent->left;
+                    }
+                    if (rb_is_black(w->right) && rb_is_black(w->left)) {
+                        w->color = RB_RED;
+                        x = x_parent;
+                        x_parent = x_parent->parent;
+                    } else {
+                        if (rb_is_black(w->left)) {
+                            w->right->color = RB_BLACK;
+                            w->color = RB_RED;
+                            rb_tree_rotate_left(w, root);
+                            w = x_parent->left;
+                        }
+                        w->color = x_parent->color;
+                        x_parent->color = RB_BLACK;
+                        if (w->left) {
+                            w->left->color = RB_BLACK;
+                        }
+                        rb_tree_rotate_right(x_parent, root);
+                        break;
+                    }
+                }
+            }
+            if (x) {
+                x->color = RB_BLACK;
+            }
+        }
+        return y;
+    }
+
+    /**
+     * @brief Nombre de noeuds noirs sur chaque chemin de x à une feuille, ou
+     * -1 si l'arbre enraciné en x viole une propriété rouge-noir ou l'ordre
+     * des liens parent. Sert aux tests.
+     */
+    inline int rb_tree_black_height(const rb_node_base* x) {
+        if (!x) {
+            return 1;
+        }
+        if ((x->left && x->left->parent != x) || (x->right && x->right->parent != x)) {
+            return -1;
+        }
+        if (x->color == RB_RED && (!rb_is_black(x->left) || !rb_is_black(x->right))) {
+            return -1;
+        }
+        int left = rb_tree_black_height(x->left);
+        int right = rb_tree_black_height(x->right);
+        if (left < 0 || left != right) {
+            return -1;
+        }
+        return left + (x->color == RB_BLACK ? 1 : 0);
+    }
+}
+
+#endif
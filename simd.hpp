@@ -0,0 +1,744 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _SIMD_HPP_
+#define _SIMD_HPP_
+
+#include <cstddef>
+
+#include "type_traits.hpp"
+
+#if !defined(FT_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define FT_SIMD_X86 1
+#include <immintrin.h>
+#define FT_SIMD_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace ft {
+    namespace simd {
+
+        /**
+         * @brief Jeux d'instructions vectorielles reconnus, du moins au plus large.
+         */
+        enum isa { ISA_SCALAR, ISA_SSE2, ISA_AVX2, ISA_AVX512 };
+
+        /**
+         * @brief Interroge le processeur (cpuid, via __builtin_cpu_supports qui
+         * vérifie aussi le support par l'OS des registres étendus) et renvoie
+         * le jeu d'instructions le plus large utilisable.
+         * Définir FT_NO_SIMD à la compilation force le code scalaire.
+         */
+        inline isa detect_isa(void) {
+#ifdef FT_SIMD_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) {
+                return ISA_AVX512;
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                return ISA_AVX2;
+            }
+            if (__builtin_cpu_supports("sse2")) {
+                return ISA_SSE2;
+            }
+#endif
+            return ISA_SCALAR;
+        }
+
+        /**
+         * @brief Jeu d'instructions retenu, détecté une seule fois par processus.
+         */
+        inline isa active_isa(void) {
+            static const isa level = detect_isa();
+            return level;
+        }
+
+        /**
+         * @brief Renvoie le premier indice i < n tel que !(a[i] == b[i]), ou n.
+         */
+        template < class T >
+        std::size_t find_unequal_scalar(const T* a, const T* b, std::size_t n) {
+            std::size_t i = 0;
+            while (i < n && a[i] == b[i]) {
+                ++i;
+            }
+            return i;
+        }
+
+        /**
+         * @brief Renvoie le premier indice i < n tel que a[i] < b[i] ou b[i] < a[i],
+         * ou n. Diffère de find_unequal_scalar pour les NaN, qui ne sont
+         * ni inférieurs ni supérieurs à une autre valeur.
+         */
+        template < class T >
+        std::size_t find_less_greater_scalar(const T* a, const T* b, std::size_t n) {
+            std::size_t i = 0;
+            while (i < n && !(a[i] < b[i] || b[i] < a[i])) {
+                ++i;
+            }
+            return i;
+        }
+
+#ifdef FT_SIMD_X86
+        /*
+        Noyaux x86. Chacun traite des blocs d'un registre entier puis finit
+        l'intervalle avec la version scalaire. Pour les entiers, l'égalité est
+        celle des octets : le premier octet différent donne le premier élément
+        différent.
+        */
+
+        FT_SIMD_TARGET("sse2")
+        inline std::size_t find_unequal_bytes_sse2(const unsigned char* a,
+                                                const unsigned char* b, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                __m128i va = _mm_loadu_si128(reinterpret_cast< const __m128i* >(a + i));
+                __m128i vb = _mm_loadu_si128(reinterpret_cast< const __m128i* >(b + i));
+                unsigned mask = ~static_cast< unsigned >(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb))) &
+                                0xFFFFu;
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_unequal_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("avx2")
+        inline std::size_t find_unequal_bytes_avx2(const unsigned char* a,
+                                                const unsigned char* b, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 32 <= n; i += 32) {
+                __m256i va = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(a + i));
+                __m256i vb = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(b + i));
+                unsigned mask =
+                    ~static_cast< unsigned >(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_unequal_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("avx512f")
+        inline std::size_t find_unequal_i32_avx512(const int* a, const int* b, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                __mmask16 mask = _mm512_cmpneq_epi32_mask(_mm512_loadu_si512(a + i),
+                                                        _mm512_loadu_si512(b + i));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_unequal_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("avx512f")
+        inline std::size_t find_unequal_i64_avx512(const long* a, const long* b, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __mmask8 mask = _mm512_cmpneq_epi64_mask(_mm512_loadu_si512(a + i),
+                                                        _mm512_loadu_si512(b + i));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_unequal_scalar(a + i, b + i, n - i);
+        }
+
+        /*
+        Flottants : « unequal » est vrai pour un NaN (comme !(a == b)),
+        « less_greater » est faux pour un NaN (comme a < b || b < a).
+        */
+
+        FT_SIMD_TARGET("sse2")
+        inline std::size_t find_unequal_f32_sse2(const float* a, const float* b, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                int mask = _mm_movemask_ps(_mm_cmpneq_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_unequal_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("sse2")
+        inline std::size_t find_less_greater_f32_sse2(const float* a, const float* b,
+                                                    std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128 va = _mm_loadu_ps(a + i);
+                __m128 vb = _mm_loadu_ps(b + i);
+                int mask = _mm_movemask_ps(_mm_and_ps(_mm_cmpneq_ps(va, vb), _mm_cmpord_ps(va, vb)));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_less_greater_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("sse2")
+        inline std::size_t find_unequal_f64_sse2(const double* a, const double* b, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                int mask = _mm_movemask_pd(_mm_cmpneq_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_unequal_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("sse2")
+        inline std::size_t find_less_greater_f64_sse2(const double* a, const double* b,
+                                                    std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                __m128d va = _mm_loadu_pd(a + i);
+                __m128d vb = _mm_loadu_pd(b + i);
+                int mask = _mm_movemask_pd(_mm_and_pd(_mm_cmpneq_pd(va, vb), _mm_cmpord_pd(va, vb)));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_less_greater_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("avx2")
+        inline std::size_t find_unequal_f32_avx2(const float* a, const float* b, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                int mask = _mm256_movemask_ps(
+                    _mm256_cmp_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _CMP_NEQ_UQ));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_unequal_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("avx2")
+        inline std::size_t find_less_greater_f32_avx2(const float* a, const float* b,
+                                                    std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                int mask = _mm256_movemask_ps(
+                    _mm256_cmp_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _CMP_NEQ_OQ));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_less_greater_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("avx2")
+        inline std::size_t find_unequal_f64_avx2(const double* a, const double* b, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                int mask = _mm256_movemask_pd(
+                    _mm256_cmp_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), _CMP_NEQ_UQ));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_unequal_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("avx2")
+        inline std::size_t find_less_greater_f64_avx2(const double* a, const double* b,
+                                                    std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                int mask = _mm256_movemask_pd(
+                    _mm256_cmp_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), _CMP_NEQ_OQ));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_less_greater_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("avx512f")
+        inline std::size_t find_unequal_f32_avx512(const float* a, const float* b,
+                                                std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i),
+                                                    _CMP_NEQ_UQ);
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_unequal_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("avx512f")
+        inline std::size_t find_less_greater_f32_avx512(const float* a, const float* b,
+                                                    std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i),
+                                                    _CMP_NEQ_OQ);
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_less_greater_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("avx512f")
+        inline std::size_t find_unequal_f64_avx512(const double* a, const double* b,
+                                                std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __mmask8 mask = _mm512_cmp_pd_mask(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i),
+                                                    _CMP_NEQ_UQ);
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_unequal_scalar(a + i, b + i, n - i);
+        }
+
+        FT_SIMD_TARGET("avx512f")
+        inline std::size_t find_less_greater_f64_avx512(const double* a, const double* b,
+                                                    std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __mmask8 mask = _mm512_cmp_pd_mask(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i),
+                                                    _CMP_NEQ_OQ);
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + find_less_greater_scalar(a + i, b + i, n - i);
+        }
+
+        /*
+        Adaptateurs entiers : ramènent les noyaux sur octets (ou sur mots de
+        32 / 64 bits pour AVX-512F, qui n'a pas de comparaison d'octets) à la
+        signature commune des noyaux.
+        */
+
+        template < class T >
+        std::size_t find_unequal_int_sse2(const T* a, const T* b, std::size_t n) {
+            return find_unequal_bytes_sse2(reinterpret_cast< const unsigned char* >(a),
+                                        reinterpret_cast< const unsigned char* >(b),
+                                        n * sizeof(T)) /
+                sizeof(T);
+        }
+
+        template < class T >
+        std::size_t find_unequal_int_avx2(const T* a, const T* b, std::size_t n) {
+            return find_unequal_bytes_avx2(reinterpret_cast< const unsigned char* >(a),
+                                        reinterpret_cast< const unsigned char* >(b),
+                                        n * sizeof(T)) /
+                sizeof(T);
+        }
+
+        template < class T >
+        std::size_t find_unequal_int_avx512(const T* a, const T* b, std::size_t n) {
+            if (sizeof(T) == sizeof(int)) {
+                return find_unequal_i32_avx512(reinterpret_cast< const int* >(a),
+                                            reinterpret_cast< const int* >(b), n);
+            }
+            return find_unequal_i64_avx512(reinterpret_cast< const long* >(a),
+                                        reinterpret_cast< const long* >(b), n);
+        }
+#endif
+
+        /**
+         * @brief Paire de noyaux de comparaison pour le type T.
+         */
+        template < class T >
+        struct kernels {
+            typedef std::size_t (*kernel)(const T*, const T*, std::size_t);
+
+            /* Premier indice i tel que !(a[i] == b[i]) */
+            kernel find_unequal;
+            /* Premier indice i tel que a[i] < b[i] || b[i] < a[i] */
+            kernel find_less_greater;
+        };
+
+        /**
+         * @brief Noyaux scalaires, utilisés pour tout type sans noyau
+         * vectoriel et quand le processeur n'en propose aucun.
+         */
+        template < class T >
+        kernels< T > scalar_kernels(void) {
+            kernels< T > k;
+            k.find_unequal = &find_unequal_scalar< T >;
+            k.find_less_greater = &find_less_greater_scalar< T >;
+            return k;
+        }
+
+        /**
+         * @brief Noyaux pour les entiers de 32 ou 64 bits : l'égalité et
+         * l'équivalence y sont la même relation.
+         */
+        template < class T >
+        kernels< T > integer_kernels(isa level) {
+            kernels< T > k = scalar_kernels< T >();
+#ifdef FT_SIMD_X86
+            if (level >= ISA_AVX512 && (sizeof(T) == sizeof(int) || sizeof(T) == sizeof(long))) {
+                k.find_unequal = &find_unequal_int_avx512< T >;
+            } else if (level >= ISA_AVX2) {
+                k.find_unequal = &find_unequal_int_avx2< T >;
+            } else if (level >= ISA_SSE2) {
+                k.find_unequal = &find_unequal_int_sse2< T >;
+            }
+            k.find_less_greater = k.find_unequal;
+#else
+            (void)level;
+#endif
+            return k;
+        }
+
+        /**
+         * @brief Sélectionne les noyaux de T pour le jeu d'instructions level.
+         * Les types sans spécialisation utilisent les noyaux scalaires.
+         */
+        template < class T >
+        struct kernel_selector {
+            static kernels< T > select(isa) { return scalar_kernels< T >(); }
+        };
+
+        template <>
+        struct kernel_selector< int > {
+            static kernels< int > select(isa level) { return integer_kernels< int >(level); }
+        };
+
+        template <>
+        struct kernel_selector< unsigned int > {
+            static kernels< unsigned int > select(isa level) {
+                return integer_kernels< unsigned int >(level);
+            }
+        };
+
+        template <>
+        struct kernel_selector< long > {
+            static kernels< long > select(isa level) { return integer_kernels< long >(level); }
+        };
+
+        template <>
+        struct kernel_selector< unsigned long > {
+            static kernels< unsigned long > select(isa level) {
+                return integer_kernels< unsigned long >(level);
+            }
+        };
+
+        template <>
+        struct kernel_selector< float > {
+            static kernels< float > select(isa level) {
+                kernels< float > k = scalar_kernels< float >();
+#ifdef FT_SIMD_X86
+                if (level >= ISA_AVX512) {
+                    k.find_unequal = &find_unequal_f32_avx512;
+                    k.find_less_greater = &find_less_greater_f32_avx512;
+                } else if (level >= ISA_AVX2) {
+                    k.find_unequal = &find_unequal_f32_avx2;
+                    k.find_less_greater = &find_less_greater_f32_avx2;
+                } else if (level >= ISA_SSE2) {
+                    k.find_unequal = &find_unequal_f32_sse2;
+                    k.find_less_greater = &find_less_greater_f32_sse2;
+                }
+#else
+                (void)level;
+#endif
+                return k;
+            }
+        };
+
+        template <>
+        struct kernel_selector< double > {
+            static kernels< double > select(isa level) {
+                kernels< double > k = scalar_kernels< double >();
+#ifdef FT_SIMD_X86
+                if (level >= ISA_AVX512) {
+                    k.find_unequal = &find_unequal_f64_avx512;
+                    k.find_less_greater = &find_less_greater_f64_avx512;
+                } else if (level >= ISA_AVX2) {
+                    k.find_unequal = &find_unequal_f64_avx2;
+                    k.find_less_greater = &find_less_greater_f64_avx2;
+                } else if (level >= ISA_SSE2) {
+                    k.find_unequal = &find_unequal_f64_sse2;
+                    k.find_less_greater = &find_less_greater_f64_sse2;
+                }
+#else
+                (void)level;
+#endif
+                return k;
+            }
+        };
+
+        /**
+         * @brief Vérifie si T dispose de noyaux vectoriels.
+         */
+        template < class T >
+        struct has_kernels : public ft::false_type {};
+
+        template <>
+        struct has_kernels< int > : public ft::true_type {};
+        template <>
+        struct has_kernels< unsigned int > : public ft::true_type {};
+        template <>
+        struct has_kernels< long > : public ft::true_type {};
+        template <>
+        struct has_kernels< unsigned long > : public ft::true_type {};
+        template <>
+        struct has_kernels< float > : public ft::true_type {};
+        template <>
+        struct has_kernels< double > : public ft::true_type {};
+
+        /**
+         * @brief Noyaux de T pour le processeur courant, choisis une seule fois.
+         */
+        template < class T >
+        const kernels< T >& active_kernels(void) {
+            static const kernels< T > k = kernel_selector< T >::select(active_isa());
+            return k;
+        }
+
+        /*
+        Recherche dans un petit tableau trié de clés entières signées, comme
+        celui d'un noeud de ft::btree_map : compter les clés inférieures à k
+        donne lower_bound, compter les clés supérieures donne upper_bound. Le
+        tableau est parcouru en entier, sans branchement dépendant des données.
+        */
+
+        template < class T >
+        std::size_t count_less_scalar(const T* keys, std::size_t n, T k) {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                count += (keys[i] < k);
+            }
+            return count;
+        }
+
+        template < class T >
+        std::size_t count_greater_scalar(const T* keys, std::size_t n, T k) {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                count += (k < keys[i]);
+            }
+            return count;
+        }
+
+#ifdef FT_SIMD_X86
+        FT_SIMD_TARGET("sse2")
+        inline std::size_t count_less_i32_sse2(const int* keys, std::size_t n, int k) {
+            __m128i vk = _mm_set1_epi32(k);
+            std::size_t count = 0;
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast< const __m128i* >(keys + i));
+                count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(vk, v))));
+            }
+            return count + count_less_scalar(keys + i, n - i, k);
+        }
+
+        FT_SIMD_TARGET("sse2")
+        inline std::size_t count_greater_i32_sse2(const int* keys, std::size_t n, int k) {
+            __m128i vk = _mm_set1_epi32(k);
+            std::size_t count = 0;
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast< const __m128i* >(keys + i));
+                count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, vk))));
+            }
+            return count + count_greater_scalar(keys + i, n - i, k);
+        }
+
+        FT_SIMD_TARGET("avx2")
+        inline std::size_t count_less_i32_avx2(const int* keys, std::size_t n, int k) {
+            __m256i vk = _mm256_set1_epi32(k);
+            std::size_t count = 0;
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(keys + i));
+                count += __builtin_popcount(
+                    _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(vk, v))));
+            }
+            return count + count_less_scalar(keys + i, n - i, k);
+        }
+
+        FT_SIMD_TARGET("avx2")
+        inline std::size_t count_greater_i32_avx2(const int* keys, std::size_t n, int k) {
+            __m256i vk = _mm256_set1_epi32(k);
+            std::size_t count = 0;
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(keys + i));
+                count += __builtin_popcount(
+                    _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, vk))));
+            }
+            return count + count_greater_scalar(keys + i, n - i, k);
+        }
+
+        FT_SIMD_TARGET("avx2")
+        inline std::size_t count_less_i64_avx2(const long* keys, std::size_t n, long k) {
+            __m256i vk = _mm256_set1_epi64x(k);
+            std::size_t count = 0;
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(keys + i));
+                count += __builtin_popcount(
+                    _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(vk, v))));
+            }
+            return count + count_less_scalar(keys + i, n - i, k);
+        }
+
+        FT_SIMD_TARGET("avx2")
+        inline std::size_t count_greater_i64_avx2(const long* keys, std::size_t n, long k) {
+            __m256i vk = _mm256_set1_epi64x(k);
+            std::size_t count = 0;
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(keys + i));
+                count += __builtin_popcount(
+                    _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(v, vk))));
+            }
+            return count + count_greater_scalar(keys + i, n - i, k);
+        }
+#endif
+
+        /**
+         * @brief Noyaux de recherche dans un tableau trié de clés T.
+         */
+        template < class T >
+        struct search_kernels {
+            typedef std::size_t (*kernel)(const T*, std::size_t, T);
+
+            /* Nombre de clés inférieures à k, soit lower_bound */
+            kernel count_less;
+            /* Nombre de clés supérieures à k, soit n - upper_bound */
+            kernel count_greater;
+        };
+
+        template < class T >
+        search_kernels< T > scalar_search_kernels(void) {
+            search_kernels< T > k;
+            k.count_less = &count_less_scalar< T >;
+            k.count_greater = &count_greater_scalar< T >;
+            return k;
+        }
+
+        /**
+         * @brief Sélectionne les noyaux de recherche de T pour le jeu
+         * d'instructions level.
+         */
+        template < class T >
+        struct search_kernel_selector {
+            static search_kernels< T > select(isa) { return scalar_search_kernels< T >(); }
+        };
+
+        template <>
+        struct search_kernel_selector< int > {
+            static search_kernels< int > select(isa level) {
+                search_kernels< int > k = scalar_search_kernels< int >();
+#ifdef FT_SIMD_X86
+                if (level >= ISA_AVX2) {
+                    k.count_less = &count_less_i32_avx2;
+                    k.count_greater = &count_greater_i32_avx2;
+                } else if (level >= ISA_SSE2) {
+                    k.count_less = &count_less_i32_sse2;
+                    k.count_greater = &count_greater_i32_sse2;
+                }
+#else
+                (void)level;
+#endif
+                return k;
+            }
+        };
+
+        template <>
+        struct search_kernel_selector< long > {
+            static search_kernels< long > select(isa level) {
+                search_kernels< long > k = scalar_search_kernels< long >();
+#ifdef FT_SIMD_X86
+                if (level >= ISA_AVX2 && sizeof(long) == 8) {
+                    k.count_less = &count_less_i64_avx2;
+                    k.count_greater = &count_greater_i64_avx2;
+                }
+#else
+                (void)level;
+#endif
+                return k;
+            }
+        };
+
+        /**
+         * @brief Vérifie si T dispose de noyaux de recherche vectoriels.
+         */
+        template < class T >
+        struct has_search_kernels : public ft::false_type {};
+
+        template <>
+        struct has_search_kernels< int > : public ft::true_type {};
+        template <>
+        struct has_search_kernels< long > : public ft::true_type {};
+
+        /**
+         * @brief Noyaux de recherche de T pour le processeur courant, choisis
+         * une seule fois.
+         */
+        template < class T >
+        const search_kernels< T >& active_search_kernels(void) {
+            static const search_kernels< T > k = search_kernel_selector< T >::select(active_isa());
+            return k;
+        }
+
+        /*
+        Groupes de 16 octets de contrôle d'une table de hachage ouverte, comme
+        celle de ft::unordered_flat_map. SSE2 faisant partie de x86-64, ces
+        opérations sont choisies à la compilation et restent inlinées : un
+        appel indirect par groupe coûterait autant que la comparaison.
+        */
+#if defined(FT_SIMD_X86) && defined(__SSE2__)
+#define FT_SIMD_GROUP_SSE2 1
+#endif
+
+        /**
+         * @brief Masque de 16 bits dont le bit i vaut 1 si ctrl[i] == byte.
+         */
+        inline unsigned group_match(const signed char* ctrl, signed char byte) {
+#ifdef FT_SIMD_GROUP_SSE2
+            __m128i v = _mm_loadu_si128(reinterpret_cast< const __m128i* >(ctrl));
+            return static_cast< unsigned >(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(byte))));
+#else
+            unsigned mask = 0;
+            for (unsigned i = 0; i < 16; ++i) {
+                mask |= static_cast< unsigned >(ctrl[i] == byte) << i;
+            }
+            return mask;
+#endif
+        }
+
+        /**
+         * @brief Masque de 16 bits dont le bit i vaut 1 si ctrl[i] est négatif.
+         */
+        inline unsigned group_match_negative(const signed char* ctrl) {
+#ifdef FT_SIMD_GROUP_SSE2
+            __m128i v = _mm_loadu_si128(reinterpret_cast< const __m128i* >(ctrl));
+            return static_cast< unsigned >(_mm_movemask_epi8(v));
+#else
+            unsigned mask = 0;
+            for (unsigned i = 0; i < 16; ++i) {
+                mask |= static_cast< unsigned >(ctrl[i] < 0) << i;
+            }
+            return mask;
+#endif
+        }
+    }
+}
+
+#endif
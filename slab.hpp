@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   slab.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _SLAB_HPP_
+#define _SLAB_HPP_
+
+#include <cstddef>
+#include <memory>
+
+#include "util.hpp"
+#include "utility.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Réserve de noeuds de taille fixe : les emplacements sont
+     * découpés dans des tranches contiguës obtenues d'Alloc, de taille
+     * doublant jusqu'à MAX_SLOTS, et les emplacements libérés sont chaînés
+     * pour être réutilisés. Les noeuds voisins dans l'ordre d'insertion
+     * restent ainsi proches en mémoire, et release rend toutes les tranches
+     * en un appel par tranche.
+     * La réserve ne construit rien : l'appelant construit et détruit ce qu'il
+     * place dans chaque emplacement.
+     *
+     * @tparam Node Type des noeuds.
+     * @tparam Alloc Allocateur, relié à Node avant usage.
+     */
+    template < class Node, class Alloc = std::allocator< Node > >
+    class node_slab {
+        public:
+            typedef typename Alloc::template rebind< Node >::other allocator_type;
+            typedef std::size_t size_type;
+
+            static const size_type MIN_SLOTS = 16;
+            static const size_type MAX_SLOTS = 4096;
+
+        private:
+            /**
+             * @brief Emplacement libre, chaîné dans la liste libre.
+             */
+            struct free_slot {
+                free_slot* next;
+            };
+
+            /**
+             * @brief En-tête placé dans les premiers emplacements de chaque tranche.
+             */
+            struct slab_header {
+                slab_header* next;
+                size_type slots;
+            };
+
+            /* Nombre d'emplacements occupés par l'en-tête d'une tranche */
+            static const size_type HEADER_SLOTS =
+                (sizeof(slab_header) + sizeof(Node) - 1) / sizeof(Node);
+
+            allocator_type _alloc;
+            free_slot* _free;
+            slab_header* _slabs;
+            size_type _next_slots;
+
+        public:
+            explicit node_slab(const allocator_type& alloc = allocator_type())
+                : _alloc(alloc), _free(u_nullptr), _slabs(u_nullptr), _next_slots(MIN_SLOTS) {}
+
+            ~node_slab() { this->release(); }
+
+            /**
+             * @brief Renvoie un emplacement non construit.
+             */
+            Node* allocate() {
+                if (!this->_free) {
+                    this->_refill();
+                }
+                free_slot* slot = this->_free;
+                this->_free = slot->next;
+                return reinterpret_cast< Node* >(slot);
+            }
+
+            /**
+             * @brief Rend un emplacement obtenu par allocate, déjà détruit.
+             */
+            void deallocate(Node* node) {
+                free_slot* slot = reinterpret_cast< free_slot* >(node);
+                slot->next = this->_free;
+                this->_free = slot;
+            }
+
+            /**
+             * @brief Rend toutes les tranches à l'allocateur. Tous les
+             * emplacements doivent avoir été détruits.
+             */
+            void release() {
+                while (this->_slabs) {
+                    slab_header* next = this->_slabs->next;
+                    this->_alloc.deallocate(reinterpret_cast< Node* >(this->_slabs),
+                                            this->_slabs->slots);
+                    this->_slabs = next;
+                }
+                this->_free = u_nullptr;
+                this->_next_slots = MIN_SLOTS;
+            }
+
+            void swap(node_slab& other) {
+                ft::swap(this->_alloc, other._alloc);
+                ft::swap(this->_free, other._free);
+                ft::swap(this->_slabs, other._slabs);
+                ft::swap(this->_next_slots, other._next_slots);
+            }
+
+            allocator_type get_allocator() const { return this->_alloc; }
+
+        private:
+            node_slab(const node_slab&);
+            node_slab& operator=(const node_slab&);
+
+            void _refill() {
+                size_type slots = this->_next_slots;
+                Node* raw = this->_alloc.allocate(slots);
+                slab_header* header = reinterpret_cast< slab_header* >(raw);
+                header->next = this->_slabs;
+                header->slots = slots;
+                this->_slabs = header;
+                if (this->_next_slots < MAX_SLOTS) {
+                    this->_next_slots *= 2;
+                }
+
+                /* chaîne les emplacements dans l'ordre des adresses */
+                free_slot* head = this->_free;
+                for (size_type i = slots; i-- > HEADER_SLOTS;) {
+                    free_slot* slot = reinterpret_cast< free_slot* >(raw + i);
+                    slot->next = head;
+                    head = slot;
+                }
+                this->_free = head;
+            }
+    };
+}
+
+#endif
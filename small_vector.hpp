@@ -0,0 +1,347 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _SMALL_VECTOR_HPP_
+#define _SMALL_VECTOR_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+#include "vector.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Stockage en ligne d'un small_vector : N emplacements non
+     * construits et un indicateur d'occupation.
+     * L'union aligne le tampon sur les types scalaires les plus contraints.
+     *
+     * @tparam T Type des éléments.
+     * @tparam N Nombre d'éléments stockés en ligne, strictement positif.
+     */
+    template < class T, std::size_t N >
+    struct small_vector_storage {
+        union {
+            char bytes[N * sizeof(T)];
+            long double align_ld;
+            void* align_ptr;
+            long align_l;
+        } buffer;
+        bool in_use;
+
+        small_vector_storage() : in_use(false) {}
+
+        T* data() { return reinterpret_cast< T* >(this->buffer.bytes); }
+
+        const T* data() const { return reinterpret_cast< const T* >(this->buffer.bytes); }
+
+    private:
+        small_vector_storage(const small_vector_storage&);
+        small_vector_storage& operator=(const small_vector_storage&);
+    };
+
+    /**
+     * @brief Allocateur qui sert une demande d'au plus N éléments depuis le
+     * stockage en ligne d'un small_vector tant qu'il est libre, et délègue
+     * toute autre demande à Alloc.
+     *
+     * @tparam T Type des éléments.
+     * @tparam N Nombre d'éléments stockés en ligne.
+     * @tparam Alloc Allocateur utilisé au-delà du stockage en ligne.
+     */
+    template < class T, std::size_t N, class Alloc = std::allocator< T > >
+    class inline_allocator : public Alloc {
+        public:
+            typedef typename Alloc::pointer pointer;
+            typedef typename Alloc::size_type size_type;
+            typedef small_vector_storage< T, N > storage_type;
+
+            template < class U >
+            struct rebind {
+                typedef typename Alloc::template rebind< U >::other other;
+            };
+
+        private:
+            storage_type* _storage;
+
+        public:
+            explicit inline_allocator(storage_type* storage = u_nullptr,
+                                    const Alloc& alloc = Alloc())
+                : Alloc(alloc), _storage(storage) {}
+
+            inline_allocator(const inline_allocator& other)
+                : Alloc(other), _storage(other._storage) {}
+
+            inline_allocator& operator=(const inline_allocator& other) {
+                Alloc::operator=(other);
+                this->_storage = other._storage;
+                return *this;
+            }
+
+            pointer allocate(size_type n, const void* hint = 0) {
+                if (this->_storage && !this->_storage->in_use && n <= N) {
+                    this->_storage->in_use = true;
+                    return this->_storage->data();
+                }
+                return Alloc::allocate(n, hint);
+            }
+
+            void deallocate(pointer p, size_type n) {
+                if (this->_storage && p == this->_storage->data()) {
+                    this->_storage->in_use = false;
+                    return;
+                }
+                Alloc::deallocate(p, n);
+            }
+    };
+
+    /**
+     * @brief Un vecteur qui stocke ses N premiers éléments dans l'objet
+     * lui-même et ne passe par Alloc qu'au-delà.
+     * Il hérite de toute l'interface de ft::vector (itérateurs
+     * ft::random_access_iterator et ft::reverse_iterator, insert, erase...),
+     * seuls les constructeurs, les affectations, swap et shrink_to_fit sont
+     * redéfinis, car le stockage en ligne ne peut pas changer d'objet.
+     * Un small_vector ne doit pas être affecté par déplacement à travers une
+     * référence vers sa base ft::vector.
+     *
+     * @tparam T Type des éléments.
+     * @tparam N Nombre d'éléments stockés en ligne, strictement positif.
+     * @tparam Alloc Allocateur utilisé au-delà de N éléments.
+     */
+    template < class T, std::size_t N, class Alloc = std::allocator< T > >
+    class small_vector : private small_vector_storage< T, N >,
+                        public vector< T, inline_allocator< T, N, Alloc > > {
+        private:
+            typedef small_vector_storage< T, N > storage_type;
+
+        public:
+            typedef vector< T, inline_allocator< T, N, Alloc > > vector_type;
+            typedef typename vector_type::value_type value_type;
+            typedef typename vector_type::allocator_type allocator_type;
+            typedef typename vector_type::size_type size_type;
+            typedef typename vector_type::iterator iterator;
+            typedef typename vector_type::const_iterator const_iterator;
+
+            /* Nombre d'éléments stockés sans allocation */
+            static const size_type inline_capacity = N;
+
+            /**
+             * @brief constructeur par défaut
+             * Construit un conteneur vide dont la capacité est N.
+             */
+            explicit small_vector(const Alloc& alloc = Alloc())
+                : storage_type(),
+                  vector_type(_inline_allocator(static_cast< storage_type* >(this), alloc)) {
+                this->reserve(N);
+            }
+
+            /**
+             * @brief constructeur de remplissage
+             * Construit un conteneur avec n copies de val.
+             */
+            explicit small_vector(size_type n, const value_type& val = value_type(),
+                                const Alloc& alloc = Alloc())
+                : storage_type(),
+                  vector_type(_inline_allocator(static_cast< storage_type* >(this), alloc)) {
+                this->reserve(N);
+                this->assign(n, val);
+            }
+
+            /**
+             * @brief constructeur d'intervalle
+             * Construit un conteneur avec une copie des éléments de [first, last).
+             */
+            template < class InputIterator >
+            small_vector(InputIterator first, InputIterator last, const Alloc& alloc = Alloc(),
+                        typename ft::enable_if< !ft::is_integral< InputIterator >::value >::type* =
+                            u_nullptr)
+                : storage_type(),
+                  vector_type(_inline_allocator(static_cast< storage_type* >(this), alloc)) {
+                this->reserve(N);
+                this->assign(first, last);
+            }
+
+            /**
+             * @brief constructeur par copie
+             * Les éléments de x sont copiés, en ligne s'ils sont au plus N.
+             */
+            small_vector(const small_vector& x)
+                : storage_type(),
+                  vector_type(_inline_allocator(static_cast< storage_type* >(this),
+                                                Alloc(x.get_allocator()))) {
+                this->reserve(N);
+                this->assign(x.begin(), x.end());
+            }
+
+            small_vector& operator=(const small_vector& x) {
+                vector_type::operator=(x);
+                return *this;
+            }
+
+#ifdef FT_CONTAINERS_CXX11
+            /**
+             * @brief constructeur par déplacement
+             * Si x a débordé sur le tas, son stockage est repris tel quel ;
+             * sinon ses éléments sont déplacés un par un dans le stockage en ligne.
+             */
+            small_vector(small_vector&& x)
+                : storage_type(),
+                  vector_type(_inline_allocator(static_cast< storage_type* >(this),
+                                                Alloc(x.get_allocator()))) {
+                if (x._on_heap()) {
+                    this->_swap_storage(x);
+                    x.reserve(N);
+                    return;
+                }
+                this->reserve(N);
+                this->_move_elements_from(x);
+            }
+
+            /**
+             * @brief affectation par déplacement
+             */
+            small_vector& operator=(small_vector&& x) {
+                if (this == &x) {
+                    return *this;
+                }
+                this->clear();
+                if (x._on_heap()) {
+                    this->_release_storage();
+                    this->_swap_storage(x);
+                    x.reserve(N);
+                    this->reserve(N);
+                    return *this;
+                }
+                this->_move_elements_from(x);
+                return *this;
+            }
+#endif
+
+            /**
+             * @brief Echange de contenu
+             * Les stockages sur le tas changent de conteneur sans copie ; seuls
+             * les éléments en ligne, au plus N par conteneur, sont copiés.
+             */
+            void swap(small_vector& x) {
+                if (this == &x) {
+                    return;
+                }
+                if (this->_on_heap() && x._on_heap()) {
+                    this->_swap_storage(x);
+                    return;
+                }
+                if (this->_on_heap() || x._on_heap()) {
+                    small_vector& heap = this->_on_heap() ? *this : x;
+                    small_vector& local = this->_on_heap() ? x : *this;
+                    vector_type stash(heap.get_allocator());
+                    heap._swap_storage(stash);
+                    heap.reserve(N);
+                    heap.insert(heap.end(), local.begin(), local.end());
+                    local.clear();
+                    local._release_storage();
+                    local._swap_storage(stash);
+                    return;
+                }
+                small_vector& longer = (this->size() >= x.size()) ? *this : x;
+                small_vector& shorter = (this->size() >= x.size()) ? x : *this;
+                size_type common = shorter.size();
+                for (size_type i = 0; i < common; ++i) {
+                    using std::swap;
+                    swap(longer[i], shorter[i]);
+                }
+                shorter.insert(shorter.end(), longer.begin() + common, longer.end());
+                longer.erase(longer.begin() + common, longer.end());
+            }
+
+            /**
+             * @brief Réduire la capacité
+             * Le stockage en ligne ne coûte rien : il est gardé tant qu'il
+             * contient les éléments, et des éléments sur le tas y reviennent
+             * dès qu'ils sont au plus N. Au-delà, la capacité sur le tas est
+             * ramenée à size() comme pour ft::vector.
+             */
+            void shrink_to_fit() {
+                if (this->is_inline()) {
+                    return;
+                }
+                if (this->size() > N) {
+                    vector_type::shrink_to_fit();
+                    return;
+                }
+                vector_type stash(this->get_allocator());
+                this->_swap_storage(stash);
+                this->reserve(N);
+#ifdef FT_CONTAINERS_CXX11
+                for (iterator it = stash.begin(); it != stash.end(); ++it) {
+                    this->emplace_back(std::move(*it));
+                }
+#else
+                this->insert(this->end(), stash.begin(), stash.end());
+#endif
+            }
+
+            /**
+             * @brief Vérifie si les éléments sont dans le stockage en ligne.
+             */
+            bool is_inline() const {
+                return this->capacity() != 0 && this->begin().base() == this->storage_type::data();
+            }
+
+        private:
+            /**
+             * @brief Statique : appelée avant la construction de la base
+             * vector_type, elle ne reçoit que le stockage déjà construit.
+             */
+            static allocator_type _inline_allocator(storage_type* storage, const Alloc& alloc) {
+                return allocator_type(storage, alloc);
+            }
+
+            bool _on_heap() const { return this->capacity() != 0 && !this->is_inline(); }
+
+            /**
+             * @brief Rend le stockage courant (en ligne ou sur le tas) en
+             * l'échangeant avec un vecteur temporaire qui le libère à sa
+             * destruction, avec le même allocateur.
+             */
+            void _release_storage() {
+                vector_type released(this->get_allocator());
+                this->_swap_storage(released);
+            }
+
+#ifdef FT_CONTAINERS_CXX11
+            void _move_elements_from(small_vector& x) {
+                this->clear();
+                this->reserve(x.size());
+                for (iterator it = x.begin(); it != x.end(); ++it) {
+                    this->emplace_back(std::move(*it));
+                }
+                x.clear();
+            }
+#endif
+    };
+
+    template < class T, std::size_t N, class Alloc >
+    const typename small_vector< T, N, Alloc >::size_type
+        small_vector< T, N, Alloc >::inline_capacity;
+
+    /**
+     * @brief Échanger le contenu de deux small_vector
+     */
+    template < class T, std::size_t N, class Alloc >
+    void swap(small_vector< T, N, Alloc >& x, small_vector< T, N, Alloc >& y) {
+        x.swap(y);
+    }
+}
+
+#endif
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector_bench.cpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "small_vector.hpp"
+
+#include <iostream>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+namespace {
+    const std::size_t ROUNDS = 100000;
+
+    /**
+     * @brief Construit ROUNDS conteneurs temporaires remplis de size éléments
+     * par push_back, puis affiche les allocations et le temps moyen par
+     * conteneur.
+     */
+    template < class Vector >
+    void bench_fill(const char* name, std::size_t size) {
+        bench::alloc_stats::reset();
+        long checksum = 0;
+        double start = bench::now_ns();
+        for (std::size_t round = 0; round < ROUNDS; ++round) {
+            Vector v;
+            for (std::size_t i = 0; i < size; ++i) {
+                v.push_back(static_cast< int >(i + round));
+            }
+            checksum += v.empty() ? 0 : v.back();
+        }
+        double per_call_ns = (bench::now_ns() - start) / ROUNDS;
+        std::cout << "\t " << name << " size " << size << ": "
+                << static_cast< double >(bench::alloc_stats::allocations) / ROUNDS
+                << " allocations, " << per_call_ns << " ns"
+                << (checksum == -1 ? " " : "") << std::endl;
+    }
+}
+
+void bench_small_vector(void) {
+    typedef ft::vector< int, bench::counting_allocator< int > > ft_vector;
+    typedef ft::small_vector< int, 16, bench::counting_allocator< int > > ft_small_vector;
+
+    std::cout << "Bench: small_vector< int, 16 > vs vector" << std::endl;
+    for (std::size_t size = 0; size <= 32; size += (size < 4) ? 1 : 4) {
+        bench_fill< ft_vector >("ft::vector", size);
+        bench_fill< ft_small_vector >("ft::small_vector", size);
+    }
+}
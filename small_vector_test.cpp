@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector_test.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "small_vector.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+void test_small_vector_inline(void) {
+    std::cout << "\t inline storage" << std::endl;
+
+    ft::small_vector< int, 8 > ints;
+    assert(ints.empty() && ints.capacity() == 8 && ints.is_inline());
+    for (int i = 0; i < 8; ++i) {
+        ints.push_back(i);
+    }
+    assert(ints.is_inline() && ints.capacity() == 8);
+    ints.push_back(8);
+    assert(!ints.is_inline() && ints.capacity() >= 9);
+    for (int i = 0; i < 9; ++i) {
+        assert(ints[i] == i);
+    }
+
+    ft::small_vector< int, 8 > fill(5, 42);
+    assert(fill.is_inline() && fill.size() == 5 && fill.back() == 42);
+
+    int arr[] = {5, 4, 3, 2, 1};
+    ft::small_vector< int, 4 > range(arr, arr + 5);
+    assert(!range.is_inline() && range.size() == 5 && range.front() == 5);
+
+    /* shrink_to_fit garde le stockage en ligne, ou y revient */
+    ft::small_vector< int, 8 > few(3, 7);
+    few.shrink_to_fit();
+    const char* object = reinterpret_cast< const char* >(&few);
+    const char* element = reinterpret_cast< const char* >(&few[0]);
+    assert(few.is_inline() && few.capacity() == 8 && few.size() == 3);
+    assert(element >= object && element < object + sizeof(few));
+    ints.resize(5);
+    ints.shrink_to_fit();
+    assert(ints.is_inline() && ints.size() == 5 && ints[4] == 4 && ints.capacity() == 8);
+    ints.resize(12, 1);
+    ints.reserve(40);
+    ints.shrink_to_fit();
+    assert(!ints.is_inline() && ints.capacity() == 12 && ints[11] == 1);
+    ints.clear();
+    ints.shrink_to_fit();
+    assert(ints.is_inline() && ints.empty() && ints.capacity() == 8);
+
+    ft::small_vector< std::string, 2 > words(6, "word");
+    words.resize(2);
+    words.shrink_to_fit();
+    assert(words.is_inline() && words[0] == "word" && words[1] == "word");
+}
+
+void test_small_vector_interface(void) {
+    std::cout << "\t vector interface" << std::endl;
+
+    ft::small_vector< std::string, 4 > ft_strings;
+    std::vector< std::string > std_strings;
+    for (int i = 0; i < 20; ++i) {
+        std::string str(static_cast< size_t >(i) + 1, static_cast< char >('a' + i % 26));
+        ft_strings.insert(ft_strings.begin() + i / 2, str);
+        std_strings.insert(std_strings.begin() + i / 2, str);
+    }
+    ft_strings.erase(ft_strings.begin() + 3, ft_strings.begin() + 7);
+    std_strings.erase(std_strings.begin() + 3, std_strings.begin() + 7);
+    assert(ft_strings.size() == std_strings.size());
+    for (size_t i = 0; i < std_strings.size(); ++i) {
+        assert(ft_strings[i] == std_strings[i]);
+    }
+    assert(*ft_strings.rbegin() == *std_strings.rbegin());
+
+    ft::small_vector< std::string, 4 > copy(ft_strings);
+    assert(copy == ft_strings);
+    copy.resize(2);
+    assert(!copy.is_inline() && copy < ft_strings);
+    copy = ft_strings;
+    assert(copy == ft_strings && !copy.is_inline());
+
+    ft::vector< std::string, ft::inline_allocator< std::string, 4 > >& base = copy;
+    base.pop_back();
+    assert(copy.size() == ft_strings.size() - 1);
+}
+
+void test_small_vector_swap(void) {
+    std::cout << "\t swap" << std::endl;
+
+    ft::small_vector< int, 4 > small(3, 1);
+    ft::small_vector< int, 4 > large(10, 2);
+    const int* large_data = &large[0];
+
+    ft::swap(small, large);
+    assert(small.size() == 10 && small[9] == 2 && large.size() == 3 && large[0] == 1);
+    assert(large.is_inline() && &small[0] == large_data);
+
+    ft::small_vector< int, 4 > other(20, 3);
+    const int* other_data = &other[0];
+    small.swap(other);
+    assert(&small[0] == other_data && &other[0] == large_data);
+    assert(small.size() == 20 && other.size() == 10 && other[0] == 2);
+
+#ifdef FT_CONTAINERS_CXX11
+    ft::small_vector< std::string, 2 > heap(5, "heap");
+    const std::string* heap_data = &heap[0];
+    ft::small_vector< std::string, 2 > stolen(std::move(heap));
+    assert(&stolen[0] == heap_data && heap.empty() && heap.is_inline());
+
+    ft::small_vector< std::string, 2 > local(1, "local");
+    ft::small_vector< std::string, 2 > moved(std::move(local));
+    assert(moved.is_inline() && moved[0] == "local" && local.empty());
+
+    moved = std::move(stolen);
+    assert(&moved[0] == heap_data && stolen.is_inline() && stolen.empty());
+    stolen.push_back("again");
+    moved = std::move(stolen);
+    assert(moved.size() == 1 && moved[0] == "again" && stolen.empty());
+#endif
+}
+
+void test_small_vector(void) {
+    test_small_vector_inline();
+    test_small_vector_interface();
+    test_small_vector_swap();
+}
@@ -0,0 +1,296 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   snapshot.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _SNAPSHOT_HPP_
+#define _SNAPSHOT_HPP_
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "random_access_iterator.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "util.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Vérifie si des T peuvent être écrits dans un instantané et relus
+     * sur place : T trivialement copiable, ou ft::pair de deux types
+     * trivialement copiables (dont la copie définie par l'utilisateur ne
+     * fait que copier ses membres).
+     *
+     * @tparam T type à tester
+     */
+    template < class T >
+    struct is_snapshot_element : public is_trivially_copyable< T > {};
+
+    template < class T1, class T2 >
+    struct is_snapshot_element< pair< T1, T2 > >
+        : public bool_constant< is_trivially_copyable< T1 >::value &&
+                                is_trivially_copyable< T2 >::value > {};
+
+    /**
+     * @brief En-tête d'un fichier d'instantané, suivi à PAYLOAD_ALIGNMENT
+     * octets du début du fichier par les éléments bruts. Les champs sont
+     * écrits dans l'ordre des octets de la machine ; endian vaut ENDIAN_TAG
+     * et permet au lecteur de refuser un fichier d'ordre différent plutôt
+     * que de le décoder.
+     */
+    struct snapshot_header {
+        static const uint32_t ENDIAN_TAG = 0x01020304;
+        static const uint32_t VERSION = 1;
+        static const std::size_t PAYLOAD_ALIGNMENT = 64;
+
+        char magic[8];
+        uint32_t endian;
+        uint32_t version;
+        uint32_t element_size;
+        uint32_t element_alignment;
+        uint64_t count;
+        uint64_t payload_offset;
+        uint64_t payload_bytes;
+
+        static const char* expected_magic() { return "FTSNAPSH"; }
+    };
+
+    /**
+     * @brief Écrit count éléments à partir de data dans path, au format
+     * snapshot_header. En-tête, remplissage et éléments partent en un seul
+     * writev, sans tampon intermédiaire. Le fichier est d'abord écrit sous
+     * path + ".tmp" puis renommé : un lecteur ne voit jamais d'instantané
+     * partiel. Lève std::runtime_error en cas d'échec.
+     */
+    template < class T >
+    typename ft::enable_if< is_snapshot_element< T >::value >::type write_snapshot(
+        const std::string& path, const T* data, std::size_t count) {
+        snapshot_header header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, snapshot_header::expected_magic(), sizeof(header.magic));
+        header.endian = snapshot_header::ENDIAN_TAG;
+        header.version = snapshot_header::VERSION;
+        header.element_size = sizeof(T);
+        header.element_alignment = ft::alignment_of< T >::value;
+        header.count = count;
+        header.payload_offset = snapshot_header::PAYLOAD_ALIGNMENT;
+        header.payload_bytes = static_cast< uint64_t >(count) * sizeof(T);
+
+        static const char padding[snapshot_header::PAYLOAD_ALIGNMENT] = {0};
+        struct iovec parts[3];
+        parts[0].iov_base = &header;
+        parts[0].iov_len = sizeof(header);
+        parts[1].iov_base = const_cast< char* >(padding);
+        parts[1].iov_len = snapshot_header::PAYLOAD_ALIGNMENT - sizeof(header);
+        parts[2].iov_base = const_cast< void* >(static_cast< const void* >(data));
+        parts[2].iov_len = count * sizeof(T);
+
+        std::string tmp_path = path + ".tmp";
+        int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            throw std::runtime_error("ft::write_snapshot: " + tmp_path + ": " +
+                                    std::strerror(errno));
+        }
+        struct iovec* part = parts;
+        int remaining = 3;
+        while (remaining > 0) {
+            ssize_t written = writev(fd, part, remaining);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                std::string message = std::strerror(errno);
+                ::close(fd);
+                std::remove(tmp_path.c_str());
+                throw std::runtime_error("ft::write_snapshot: " + tmp_path + ": " + message);
+            }
+            /* Écriture partielle : saute les parties écrites, avance dans la suivante */
+            std::size_t done = static_cast< std::size_t >(written);
+            while (remaining > 0 && done >= part->iov_len) {
+                done -= part->iov_len;
+                ++part;
+                --remaining;
+            }
+            if (remaining > 0) {
+                part->iov_base = static_cast< char* >(part->iov_base) + done;
+                part->iov_len -= done;
+            }
+        }
+        if (::close(fd) != 0 || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+            std::string message = std::strerror(errno);
+            std::remove(tmp_path.c_str());
+            throw std::runtime_error("ft::write_snapshot: " + path + ": " + message);
+        }
+    }
+
+    template < class T, class Alloc >
+    typename ft::enable_if< is_snapshot_element< T >::value >::type write_snapshot(
+        const std::string& path, const ft::vector< T, Alloc >& v) {
+        ft::write_snapshot(path, v.empty() ? static_cast< const T* >(u_nullptr) : &v[0],
+                        v.size());
+    }
+
+    /**
+     * @brief Vue en lecture seule d'un instantané écrit par write_snapshot.
+     * Le fichier est projeté (mmap privé, lecture seule) et ses éléments
+     * sont lus en place : l'ouverture ne vérifie que l'en-tête, aucun
+     * élément n'est décodé. Lève std::runtime_error si le fichier n'est pas
+     * un instantané de T pour cette machine (ordre des octets, taille ou
+     * alignement des éléments).
+     *
+     * @tparam T Type des éléments, voir ft::is_snapshot_element.
+     */
+    template < class T >
+    class snapshot_view {
+        private:
+            typedef char element_must_be_snapshot_element
+                [ft::is_snapshot_element< T >::value ? 1 : -1];
+
+        public:
+            typedef T value_type;
+            typedef const T& const_reference;
+            typedef const T* const_pointer;
+            typedef const_reference reference;
+            typedef const_pointer pointer;
+            typedef typename ft::random_access_iterator< const value_type > const_iterator;
+            typedef const_iterator iterator;
+            typedef typename ft::reverse_iterator< const_iterator > const_reverse_iterator;
+            typedef const_reverse_iterator reverse_iterator;
+            typedef std::ptrdiff_t difference_type;
+            typedef std::size_t size_type;
+
+        private:
+            void* _map;
+            std::size_t _mapped_bytes;
+            const_pointer _data;
+            size_type _size;
+
+            snapshot_view(const snapshot_view&);
+            snapshot_view& operator=(const snapshot_view&);
+
+        public:
+            explicit snapshot_view(const std::string& path)
+                : _map(u_nullptr), _mapped_bytes(0), _data(u_nullptr), _size(0) {
+                int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    this->_fail(path, std::strerror(errno));
+                }
+                struct stat st;
+                if (fstat(fd, &st) != 0) {
+                    std::string message = std::strerror(errno);
+                    ::close(fd);
+                    this->_fail(path, message.c_str());
+                }
+                std::size_t bytes = static_cast< std::size_t >(st.st_size);
+                if (bytes < sizeof(snapshot_header)) {
+                    ::close(fd);
+                    this->_fail(path, "truncated header");
+                }
+                void* map = mmap(u_nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if (map == MAP_FAILED) {
+                    this->_fail(path, std::strerror(errno));
+                }
+                this->_map = map;
+                this->_mapped_bytes = bytes;
+                this->_validate(path);
+            }
+
+            ~snapshot_view() {
+                if (this->_map) {
+                    munmap(this->_map, this->_mapped_bytes);
+                }
+            }
+
+            const snapshot_header& header() const {
+                return *static_cast< const snapshot_header* >(this->_map);
+            }
+
+            const_iterator begin() const { return this->_data; }
+
+            const_iterator end() const { return this->_data + this->_size; }
+
+            const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+            const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+            size_type size() const { return this->_size; }
+
+            bool empty() const { return this->_size == 0; }
+
+            const_reference operator[](size_type n) const { return this->_data[n]; }
+
+            const_reference at(size_type n) const {
+                if (n >= this->_size) {
+                    throw std::out_of_range("ft::snapshot_view");
+                }
+                return this->_data[n];
+            }
+
+            const_reference front() const { return this->_data[0]; }
+
+            const_reference back() const { return this->_data[this->_size - 1]; }
+
+            const_pointer data() const { return this->_data; }
+
+        private:
+            void _fail(const std::string& path, const char* what) {
+                if (this->_map) {
+                    munmap(this->_map, this->_mapped_bytes);
+                    this->_map = u_nullptr;
+                }
+                throw std::runtime_error("ft::snapshot_view: " + path + ": " + what);
+            }
+
+            void _validate(const std::string& path) {
+                const snapshot_header& header = this->header();
+                if (std::memcmp(header.magic, snapshot_header::expected_magic(),
+                                sizeof(header.magic)) != 0) {
+                    this->_fail(path, "not a snapshot file");
+                }
+                if (header.endian != snapshot_header::ENDIAN_TAG) {
+                    this->_fail(path, "byte order mismatch");
+                }
+                if (header.version != snapshot_header::VERSION) {
+                    this->_fail(path, "unsupported version");
+                }
+                if (header.element_size != sizeof(T) ||
+                    header.element_alignment != ft::alignment_of< T >::value) {
+                    this->_fail(path, "element type mismatch");
+                }
+                /* count est borné avant le produit, qui ne peut donc pas déborder */
+                if (header.payload_offset % ft::alignment_of< T >::value != 0 ||
+                    header.payload_offset > this->_mapped_bytes ||
+                    header.count > (this->_mapped_bytes - header.payload_offset) / sizeof(T) ||
+                    header.payload_bytes != header.count * sizeof(T)) {
+                    this->_fail(path, "truncated payload");
+                }
+                this->_data = reinterpret_cast< const_pointer >(
+                    static_cast< const char* >(this->_map) + header.payload_offset);
+                this->_size = static_cast< size_type >(header.count);
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   snapshot_bench.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "snapshot.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "bench.hpp"
+
+namespace {
+    const std::size_t ELEMENT_COUNT = std::size_t(1) << 22;
+
+    typedef ft::pair< unsigned long, double > entry;
+
+    template < class Container >
+    double checksum(const Container& entries) {
+        double sum = 0;
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            sum += static_cast< double >(entries[i].first) + entries[i].second;
+        }
+        return sum;
+    }
+}
+
+/**
+ * @brief Démarrage d'un service qui charge un jeu de ELEMENT_COUNT paires
+ * (clé, poids) : lecture élément par élément d'un fichier texte avec
+ * std::ifstream >>, face à l'ouverture d'un instantané ft::snapshot_view
+ * suivie d'un parcours complet (chaque page est lue une fois).
+ */
+void bench_snapshot(void) {
+    std::ostringstream base;
+    base << "/tmp/ft_snapshot_bench_" << getpid();
+    std::string text_path = base.str() + ".txt";
+    std::string snapshot_path = base.str() + ".snap";
+
+    ft::vector< entry > dataset;
+    dataset.reserve(ELEMENT_COUNT);
+    bench::lcg rng(42);
+    for (std::size_t i = 0; i < ELEMENT_COUNT; ++i) {
+        dataset.push_back(entry(rng.next(ELEMENT_COUNT), rng.next(1000) / 8.0));
+    }
+    {
+        std::ofstream text(text_path.c_str());
+        for (std::size_t i = 0; i < dataset.size(); ++i) {
+            text << dataset[i].first << ' ' << dataset[i].second << '\n';
+        }
+    }
+
+    std::cout << "Bench: snapshot, " << ELEMENT_COUNT << " ft::pair<unsigned long, double>"
+            << std::endl;
+    double sink = 0;
+
+    double start = bench::now_ns();
+    ft::write_snapshot(snapshot_path, dataset);
+    std::cout << "\t write_snapshot: " << (bench::now_ns() - start) / 1e6 << " ms" << std::endl;
+
+    start = bench::now_ns();
+    {
+        std::ifstream text(text_path.c_str());
+        ft::vector< entry > loaded;
+        entry e;
+        while (text >> e.first >> e.second) {
+            loaded.push_back(e);
+        }
+        sink += checksum(loaded);
+    }
+    std::cout << "\t std::ifstream >> into ft::vector: " << (bench::now_ns() - start) / 1e6
+            << " ms" << std::endl;
+
+    start = bench::now_ns();
+    {
+        ft::snapshot_view< entry > loaded(snapshot_path);
+        sink += checksum(loaded);
+    }
+    std::cout << "\t ft::snapshot_view open + scan: " << (bench::now_ns() - start) / 1e6
+            << " ms" << std::endl;
+
+    std::remove(text_path.c_str());
+    std::remove(snapshot_path.c_str());
+    if (sink == 1) {
+        std::cout << std::endl;
+    }
+}
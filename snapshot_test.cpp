@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   snapshot_test.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "algorithm.hpp"
+#include "snapshot.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+#include <stdint.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    struct sample {
+        long key;
+        double weight;
+        char tag;
+    };
+
+    std::string temporary_path(const char* name) {
+        std::ostringstream path;
+        path << "/tmp/ft_snapshot_" << name << "_" << getpid();
+        return path.str();
+    }
+
+    template < class T >
+    bool opens(const std::string& path) {
+        try {
+            ft::snapshot_view< T > view(path);
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Réécrit octet par octet la zone [offset, offset + size) du fichier.
+     */
+    void patch(const std::string& path, std::size_t offset, const void* bytes, std::size_t size) {
+        std::fstream file(path.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(static_cast< std::streamoff >(offset));
+        file.write(static_cast< const char* >(bytes), static_cast< std::streamsize >(size));
+    }
+}
+
+void test_snapshot(void) {
+    std::cout << "Test: snapshot" << std::endl;
+
+    assert(ft::is_snapshot_element< int >::value);
+    assert((ft::is_snapshot_element< ft::pair< int, double > >::value));
+    assert(!ft::is_snapshot_element< std::string >::value);
+    assert((!ft::is_snapshot_element< ft::pair< int, std::string > >::value));
+
+    std::string path = temporary_path("ints");
+    ft::vector< int > ints;
+    for (int i = 0; i < 100000; ++i) {
+        ints.push_back(i * 7 - 3);
+    }
+    ft::write_snapshot(path, ints);
+    {
+        ft::snapshot_view< int > view(path);
+        assert(view.size() == ints.size() && !view.empty());
+        uintptr_t address = reinterpret_cast< uintptr_t >(view.data());
+        assert(address % ft::snapshot_header::PAYLOAD_ALIGNMENT == 0);
+        assert(ft::equal(view.begin(), view.end(), ints.begin()));
+        assert(view.front() == -3 && view.back() == 99999 * 7 - 3 && view.at(10) == 67);
+        assert(*view.rbegin() == view.back() && view.rend() - view.rbegin() == 100000);
+        assert(view.header().count == 100000 && view.header().element_size == sizeof(int));
+        bool thrown = false;
+        try {
+            view.at(100000);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    /* Mauvais type d'élément : la taille enregistrée ne correspond pas */
+    assert(!opens< double >(path));
+    assert(!opens< sample >(path));
+
+    /* Ordre des octets inversé et signature corrompue */
+    uint32_t swapped = 0x04030201;
+    patch(path, 8, &swapped, sizeof(swapped));
+    assert(!opens< int >(path));
+    uint32_t tag = ft::snapshot_header::ENDIAN_TAG;
+    patch(path, 8, &tag, sizeof(tag));
+    assert(opens< int >(path));
+    patch(path, 0, "XX", 2);
+    assert(!opens< int >(path));
+
+    /* Nombre d'éléments dont la taille déborde sur 64 bits */
+    ft::write_snapshot(path, ints);
+    uint64_t huge_count = (uint64_t(1) << 62) + 1;
+    uint64_t wrapped_bytes = huge_count * sizeof(int);
+    patch(path, 24, &huge_count, sizeof(huge_count));
+    patch(path, 40, &wrapped_bytes, sizeof(wrapped_bytes));
+    assert(wrapped_bytes == sizeof(int) && !opens< int >(path));
+
+    /* Fichier tronqué */
+    ft::write_snapshot(path, ints);
+    assert(truncate(path.c_str(), 64 + 1000) == 0);
+    assert(!opens< int >(path));
+    assert(!opens< int >(temporary_path("missing")));
+
+    std::string pairs_path = temporary_path("pairs");
+    ft::vector< ft::pair< int, double > > pairs;
+    for (int i = 0; i < 1000; ++i) {
+        pairs.push_back(ft::make_pair(i, i / 4.0));
+    }
+    ft::write_snapshot(pairs_path, pairs);
+    {
+        ft::snapshot_view< ft::pair< int, double > > view(pairs_path);
+        assert(view.size() == 1000 && ft::equal(view.begin(), view.end(), pairs.begin()));
+        assert(view[999].first == 999 && view[999].second == 999 / 4.0);
+    }
+
+    std::string samples_path = temporary_path("samples");
+    ft::vector< sample > samples;
+    for (int i = 0; i < 300; ++i) {
+        sample s = {i * 1000L, i * 0.5, static_cast< char >('a' + i % 26)};
+        samples.push_back(s);
+    }
+    ft::write_snapshot(samples_path, samples);
+    {
+        ft::snapshot_view< sample > view(samples_path);
+        assert(view.size() == 300);
+        for (std::size_t i = 0; i < view.size(); ++i) {
+            assert(view[i].key == samples[i].key && view[i].weight == samples[i].weight &&
+                view[i].tag == samples[i].tag);
+        }
+    }
+
+    /* Instantané vide : en-tête seul */
+    ft::write_snapshot(samples_path, ft::vector< sample >());
+    {
+        ft::snapshot_view< sample > view(samples_path);
+        assert(view.empty() && view.begin() == view.end());
+    }
+
+    std::remove(path.c_str());
+    std::remove(pairs_path.c_str());
+    std::remove(samples_path.c_str());
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _STACK_HPP_
+#define _STACK_HPP_
+
+#include "util.hpp"
+#include "vector.hpp"
+
+namespace ft {
+    /**
+     * @brief Adaptateur de conteneur LIFO : seul le dernier élément inséré
+     * est accessible. En plus de l'interface standard, push_range et pop_n
+     * ajoutent ou retirent un lot d'éléments en un seul appel au conteneur,
+     * qui grandit alors une seule fois.
+     *
+     * @tparam T Type des éléments.
+     * @tparam Container Conteneur sous-jacent, avec back, push_back,
+     * pop_back et insert / erase d'intervalle, par défaut `ft::vector<T>`.
+     */
+    template < class T, class Container = ft::vector< T > >
+    class stack {
+        public:
+            /* Le deuxième paramètre du template (Container) */
+            typedef Container container_type;
+            typedef typename container_type::value_type value_type;
+            typedef typename container_type::size_type size_type;
+            typedef typename container_type::reference reference;
+            typedef typename container_type::const_reference const_reference;
+
+        protected:
+            container_type c;
+
+        public:
+            /**
+             * @brief constructeur à partir d'une copie de ctnr
+             */
+            explicit stack(const container_type& ctnr = container_type()) : c(ctnr) {}
+
+            bool empty() const { return this->c.empty(); }
+
+            size_type size() const { return this->c.size(); }
+
+            reference top() { return this->c.back(); }
+
+            const_reference top() const { return this->c.back(); }
+
+            void push(const value_type& val) { this->c.push_back(val); }
+
+#ifdef FT_CONTAINERS_CXX11
+            void push(value_type&& val) { this->c.push_back(std::move(val)); }
+
+            template < class... Args >
+            void emplace(Args&&... args) {
+                this->c.emplace_back(std::forward< Args >(args)...);
+            }
+#endif
+
+            void pop() { this->c.pop_back(); }
+
+            /**
+             * @brief Empile les éléments de [first, last) dans l'ordre, le
+             * dernier se retrouvant au sommet. Pour des itérateurs
+             * multi-passes, le conteneur grandit au plus une fois.
+             */
+            template < class InputIterator >
+            void push_range(InputIterator first, InputIterator last) {
+                this->c.insert(this->c.end(), first, last);
+            }
+
+            /**
+             * @brief Dépile les n éléments du sommet en un seul erase.
+             * n ne doit pas dépasser size().
+             */
+            void pop_n(size_type n) {
+                typename container_type::iterator first = this->c.end();
+                ft::advance(first, -static_cast< long >(n));
+                this->c.erase(first, this->c.end());
+            }
+
+            void swap(stack& x) { this->c.swap(x.c); }
+
+            template < class T1, class C1 >
+            friend bool operator==(const stack< T1, C1 >& lhs, const stack< T1, C1 >& rhs);
+
+            template < class T1, class C1 >
+            friend bool operator<(const stack< T1, C1 >& lhs, const stack< T1, C1 >& rhs);
+    };
+
+    template < class T, class Container >
+    bool operator==(const stack< T, Container >& lhs, const stack< T, Container >& rhs) {
+        return lhs.c == rhs.c;
+    }
+
+    template < class T, class Container >
+    bool operator!=(const stack< T, Container >& lhs, const stack< T, Container >& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template < class T, class Container >
+    bool operator<(const stack< T, Container >& lhs, const stack< T, Container >& rhs) {
+        return lhs.c < rhs.c;
+    }
+
+    template < class T, class Container >
+    bool operator<=(const stack< T, Container >& lhs, const stack< T, Container >& rhs) {
+        return !(rhs < lhs);
+    }
+
+    template < class T, class Container >
+    bool operator>(const stack< T, Container >& lhs, const stack< T, Container >& rhs) {
+        return rhs < lhs;
+    }
+
+    template < class T, class Container >
+    bool operator>=(const stack< T, Container >& lhs, const stack< T, Container >& rhs) {
+        return !(lhs < rhs);
+    }
+
+    /**
+     * @brief Échanger le contenu de deux stack
+     */
+    template < class T, class Container >
+    void swap(stack< T, Container >& x, stack< T, Container >& y) {
+        x.swap(y);
+    }
+}
+
+#endif
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack_test.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "queue.hpp"
+#include "stack.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <list>
+#include <queue>
+#include <sstream>
+#include <stack>
+#include <string>
+#include <vector>
+
+void test_stack(void) {
+    std::cout << "Test: stack" << std::endl;
+
+    ft::stack< int > ft_stack;
+    std::stack< int > std_stack;
+    for (int i = 0; i < 100; ++i) {
+        ft_stack.push(i);
+        std_stack.push(i);
+    }
+    assert(ft_stack.size() == std_stack.size() && ft_stack.top() == std_stack.top());
+
+    int batch[] = {100, 101, 102, 103, 104};
+    ft_stack.push_range(batch, batch + 5);
+    assert(ft_stack.size() == 105 && ft_stack.top() == 104);
+    ft_stack.pop_n(10);
+    for (int i = 0; i < 5; ++i) {
+        std_stack.pop();
+    }
+    assert(ft_stack.size() == std_stack.size() && ft_stack.top() == std_stack.top());
+    ft_stack.pop_n(0);
+    ft_stack.pop();
+    std_stack.pop();
+    assert(ft_stack.top() == std_stack.top());
+
+    ft::vector< int > base(3, 7);
+    ft::stack< int > from_base(base);
+    ft::stack< int > other(base);
+    assert(from_base == other && !(from_base < other));
+    other.push(0);
+    assert(from_base != other && from_base < other && other >= from_base);
+    ft::swap(from_base, other);
+    assert(from_base.size() == 4 && other.size() == 3);
+    from_base.pop_n(from_base.size());
+    assert(from_base.empty());
+
+    std::istringstream stream("a b c");
+    ft::stack< std::string, std::list< std::string > > words;
+    words.push_range(std::istream_iterator< std::string >(stream),
+                    std::istream_iterator< std::string >());
+    assert(words.size() == 3 && words.top() == "c");
+    words.pop_n(2);
+    assert(words.size() == 1 && words.top() == "a");
+}
+
+void test_queue(void) {
+    std::cout << "Test: queue" << std::endl;
+
+    ft::queue< std::string > ft_queue;
+    std::queue< std::string > std_queue;
+    for (int i = 0; i < 1000; ++i) {
+        std::string item(static_cast< size_t >(i % 13) + 1, static_cast< char >('a' + i % 26));
+        if (i % 3 == 2) {
+            ft_queue.pop();
+            std_queue.pop();
+        } else {
+            ft_queue.push(item);
+            std_queue.push(item);
+        }
+        assert(ft_queue.size() == std_queue.size());
+        assert(ft_queue.front() == std_queue.front() && ft_queue.back() == std_queue.back());
+    }
+
+    std::vector< std::string > batch(50, "batch");
+    ft_queue.push_range(batch.begin(), batch.end());
+    for (size_t i = 0; i < batch.size(); ++i) {
+        std_queue.push(batch[i]);
+    }
+    ft_queue.pop_n(300);
+    for (int i = 0; i < 300; ++i) {
+        std_queue.pop();
+    }
+    assert(ft_queue.size() == std_queue.size() && ft_queue.front() == std_queue.front());
+    ft_queue.pop_n(ft_queue.size());
+    assert(ft_queue.empty());
+
+    ft::queue< int > first;
+    ft::queue< int > second;
+    for (int i = 0; i < 10; ++i) {
+        first.push(i);
+        second.push(i + 1);
+    }
+    second.pop();
+    first.pop_n(2);
+    assert(first != second && first < second);
+    first.push(10);
+    assert(first == second && first <= second);
+    second.pop();
+    ft::swap(first, second);
+    assert(first.front() == 3 && second.front() == 2 && second.back() == 10);
+}
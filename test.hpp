@@ -18,6 +18,24 @@ void test_reverse_iterator(void);
 void test_algorithm(void);
 
 void test_vector(void);
+void test_small_vector(void);
+void test_pool_allocator(void);
+void test_arena(void);
+void test_tracking_allocator(void);
+void test_malloc_allocator(void);
+void test_huge_page_allocator(void);
+void test_mapped_vector(void);
+void test_snapshot(void);
+void test_async_reader(void);
+void test_parallel(void);
+void test_trace(void);
+void test_map(void);
+void test_btree_map(void);
+void test_unordered_flat_map(void);
+void test_flat_map(void);
+void test_flat_set(void);
+void test_stack(void);
+void test_queue(void);
 void test_utility(void);
 
 void test_random_access_iterator(void);
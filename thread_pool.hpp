@@ -0,0 +1,206 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_pool.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _THREAD_POOL_HPP_
+#define _THREAD_POOL_HPP_
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "util.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Groupe de threads réutilisable pour du parallélisme de type
+     * fork-join : run(t, count) exécute t.run(0) ... t.run(count - 1) sur les
+     * threads du groupe et sur le thread appelant, puis rend la main quand
+     * tous les appels sont terminés. Les indices sont distribués à la
+     * demande, un thread qui a fini en reprend un autre.
+     *
+     * Un seul run() occupe le groupe à la fois ; un appel concurrent ou
+     * imbriqué (depuis une tâche) s'exécute séquentiellement sur le thread
+     * appelant au lieu d'attendre.
+     */
+    class thread_pool {
+        public:
+            struct task {
+                virtual ~task() {}
+                virtual void run(std::size_t index) = 0;
+            };
+
+        private:
+            ft::vector< pthread_t > _threads;
+            pthread_mutex_t _mutex;
+            pthread_cond_t _work;
+            pthread_cond_t _done;
+            task* _task;
+            std::size_t _count;
+            std::size_t _next;
+            std::size_t _finished;
+            unsigned long _generation;
+            bool _busy;
+            bool _failed;
+            bool _stopping;
+
+            thread_pool(const thread_pool&);
+            thread_pool& operator=(const thread_pool&);
+
+        public:
+            /**
+             * @brief Nombre de processeurs en ligne, au moins 1.
+             */
+            static std::size_t hardware_concurrency() {
+                long n = sysconf(_SC_NPROCESSORS_ONLN);
+                return n > 0 ? static_cast< std::size_t >(n) : 1;
+            }
+
+            /**
+             * @brief Crée un groupe où concurrency threads, appelant compris,
+             * se partagent chaque run().
+             */
+            explicit thread_pool(std::size_t concurrency = hardware_concurrency())
+                : _task(u_nullptr),
+                    _count(0),
+                    _next(0),
+                    _finished(0),
+                    _generation(0),
+                    _busy(false),
+                    _failed(false),
+                    _stopping(false) {
+                pthread_mutex_init(&this->_mutex, u_nullptr);
+                pthread_cond_init(&this->_work, u_nullptr);
+                pthread_cond_init(&this->_done, u_nullptr);
+                this->_threads.reserve(concurrency);
+                for (std::size_t i = 1; i < concurrency; ++i) {
+                    pthread_t thread;
+                    int error = pthread_create(&thread, u_nullptr, &thread_pool::_worker, this);
+                    if (error != 0) {
+                        this->_stop();
+                        throw std::runtime_error(
+                            std::string("ft::thread_pool: pthread_create: ") +
+                            std::strerror(error));
+                    }
+                    this->_threads.push_back(thread);
+                }
+            }
+
+            ~thread_pool() { this->_stop(); }
+
+            /**
+             * @brief Nombre de threads qui exécutent un run(), appelant compris.
+             */
+            std::size_t size() const { return this->_threads.size() + 1; }
+
+            /**
+             * @brief Exécute t.run(i) pour chaque i de [0, count). Si l'un des
+             * appels lève une exception, les autres vont à leur terme puis
+             * run() lève std::runtime_error.
+             */
+            void run(task& t, std::size_t count) {
+                pthread_mutex_lock(&this->_mutex);
+                if (this->_busy || this->_threads.empty() || count < 2) {
+                    pthread_mutex_unlock(&this->_mutex);
+                    for (std::size_t i = 0; i < count; ++i) {
+                        t.run(i);
+                    }
+                    return;
+                }
+                this->_busy = true;
+                this->_task = &t;
+                this->_count = count;
+                this->_next = 0;
+                this->_finished = 0;
+                this->_failed = false;
+                ++this->_generation;
+                pthread_cond_broadcast(&this->_work);
+                this->_work_on_task();
+                while (this->_finished < this->_count) {
+                    pthread_cond_wait(&this->_done, &this->_mutex);
+                }
+                bool failed = this->_failed;
+                this->_task = u_nullptr;
+                this->_busy = false;
+                pthread_mutex_unlock(&this->_mutex);
+                if (failed) {
+                    throw std::runtime_error("ft::thread_pool: a task threw an exception");
+                }
+            }
+
+        private:
+            static void* _worker(void* self) {
+                static_cast< thread_pool* >(self)->_wait_for_tasks();
+                return u_nullptr;
+            }
+
+            void _wait_for_tasks() {
+                unsigned long seen = 0;
+                pthread_mutex_lock(&this->_mutex);
+                for (;;) {
+                    while (!this->_stopping && (!this->_task || this->_generation == seen)) {
+                        pthread_cond_wait(&this->_work, &this->_mutex);
+                    }
+                    if (this->_stopping) {
+                        break;
+                    }
+                    seen = this->_generation;
+                    this->_work_on_task();
+                }
+                pthread_mutex_unlock(&this->_mutex);
+            }
+
+            /**
+             * @brief Prend des indices de la tâche courante jusqu'à épuisement.
+             * Appelée verrou pris ; le verrou est relâché pendant chaque appel.
+             */
+            void _work_on_task() {
+                task* current = this->_task;
+                while (this->_next < this->_count) {
+                    std::size_t index = this->_next++;
+                    pthread_mutex_unlock(&this->_mutex);
+                    bool failed = false;
+                    try {
+                        current->run(index);
+                    } catch (...) {
+                        failed = true;
+                    }
+                    pthread_mutex_lock(&this->_mutex);
+                    this->_failed = this->_failed || failed;
+                    if (++this->_finished == this->_count) {
+                        pthread_cond_signal(&this->_done);
+                    }
+                }
+            }
+
+            void _stop() {
+                pthread_mutex_lock(&this->_mutex);
+                this->_stopping = true;
+                pthread_cond_broadcast(&this->_work);
+                pthread_mutex_unlock(&this->_mutex);
+                for (std::size_t i = 0; i < this->_threads.size(); ++i) {
+                    pthread_join(this->_threads[i], u_nullptr);
+                }
+                this->_threads.clear();
+                pthread_cond_destroy(&this->_done);
+                pthread_cond_destroy(&this->_work);
+                pthread_mutex_destroy(&this->_mutex);
+            }
+    };
+}
+
+#endif
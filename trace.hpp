@@ -0,0 +1,192 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _TRACE_HPP_
+#define _TRACE_HPP_
+
+/*
+ * Instrumentation optionnelle des chemins chauds de ft::vector. Sans
+ * FT_CONTAINERS_TRACE, les macros FT_TRACE_* ne produisent aucun code.
+ * Avec, chaque thread compte les réallocations, les éléments construits et
+ * détruits, et range la latence en cycles de reserve, insert, erase, assign
+ * et operator= dans un histogramme par puissance de deux.
+ */
+#ifdef FT_CONTAINERS_TRACE
+
+#include <ctime>
+#include <sstream>
+#include <string>
+
+#include "util.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define FT_TRACE_RDTSC 1
+#endif
+
+#ifdef FT_CONTAINERS_CXX11
+#define FT_TRACE_THREAD_LOCAL thread_local
+#else
+#define FT_TRACE_THREAD_LOCAL __thread
+#endif
+
+namespace ft {
+    namespace trace {
+
+        enum operation { RESERVE, INSERT, ERASE, ASSIGN, COPY_ASSIGN, OPERATION_COUNT };
+
+        inline const char* operation_name(operation op) {
+            static const char* const names[OPERATION_COUNT] = {"reserve", "insert", "erase",
+                                                                "assign", "operator="};
+            return names[op];
+        }
+
+        /**
+         * @brief Compteur de cycles : rdtsc sur x86, compteur virtuel sur
+         * AArch64, std::clock ailleurs.
+         */
+        inline unsigned long cycles() {
+#if defined(FT_TRACE_RDTSC)
+            return static_cast< unsigned long >(__rdtsc());
+#elif defined(__aarch64__)
+            unsigned long value;
+            __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+            return value;
+#else
+            return static_cast< unsigned long >(std::clock());
+#endif
+        }
+
+        /**
+         * @brief Latences d'une opération : nombre d'appels, total des cycles,
+         * et histogramme où la case i compte les appels de [2^i, 2^(i+1)) cycles.
+         */
+        struct operation_stats {
+            static const unsigned int HISTOGRAM_SIZE = 64;
+
+            unsigned long calls;
+            unsigned long cycles;
+            unsigned long histogram[HISTOGRAM_SIZE];
+        };
+
+        /**
+         * @brief Compteurs d'un thread. Agrégat sans constructeur pour pouvoir
+         * être déclaré thread local en C++98 (__thread).
+         */
+        struct thread_stats {
+            unsigned long reallocations;
+            unsigned long constructed;
+            unsigned long destroyed;
+            operation_stats operations[OPERATION_COUNT];
+
+            void reset() {
+                this->reallocations = 0;
+                this->constructed = 0;
+                this->destroyed = 0;
+                for (unsigned int op = 0; op < OPERATION_COUNT; ++op) {
+                    this->operations[op].calls = 0;
+                    this->operations[op].cycles = 0;
+                    for (unsigned int i = 0; i < operation_stats::HISTOGRAM_SIZE; ++i) {
+                        this->operations[op].histogram[i] = 0;
+                    }
+                }
+            }
+
+            void record(operation op, unsigned long elapsed) {
+                operation_stats& stats = this->operations[op];
+                unsigned int bucket = 0;
+                while (elapsed >> bucket > 1 && bucket + 1 < operation_stats::HISTOGRAM_SIZE) {
+                    ++bucket;
+                }
+                ++stats.calls;
+                stats.cycles += elapsed;
+                ++stats.histogram[bucket];
+            }
+
+            /**
+             * @brief Rapport JSON sur une ligne, au format de
+             * ft::allocation_stats::to_json : seules les opérations appelées et
+             * les cases non vides de leur histogramme sont listées.
+             */
+            std::string to_json() const {
+                std::ostringstream out;
+                out << "{\"reallocations\": " << this->reallocations
+                    << ", \"constructed\": " << this->constructed
+                    << ", \"destroyed\": " << this->destroyed << ", \"operations\": {";
+                const char* op_separator = "";
+                for (unsigned int op = 0; op < OPERATION_COUNT; ++op) {
+                    const operation_stats& stats = this->operations[op];
+                    if (stats.calls == 0) {
+                        continue;
+                    }
+                    out << op_separator << "\"" << operation_name(static_cast< operation >(op))
+                        << "\": {\"calls\": " << stats.calls << ", \"cycles\": " << stats.cycles
+                        << ", \"histogram\": {";
+                    const char* separator = "";
+                    for (unsigned int i = 0; i < operation_stats::HISTOGRAM_SIZE; ++i) {
+                        if (stats.histogram[i]) {
+                            out << separator << "\"" << (1UL << i) << "\": " << stats.histogram[i];
+                            separator = ", ";
+                        }
+                    }
+                    out << "}}";
+                    op_separator = ", ";
+                }
+                out << "}}";
+                return out.str();
+            }
+        };
+
+        /**
+         * @brief Compteurs du thread appelant, à zéro au premier accès.
+         */
+        inline thread_stats& local() {
+            static FT_TRACE_THREAD_LOCAL thread_stats stats;
+            return stats;
+        }
+
+        /**
+         * @brief Mesure la durée de vie de l'objet et l'ajoute à l'histogramme
+         * de op. Les opérations imbriquées (un assign qui réserve) sont
+         * comptées chacune avec leur durée propre, enfants compris.
+         */
+        class scope {
+            private:
+                operation _op;
+                unsigned long _start;
+
+                scope(const scope&);
+                scope& operator=(const scope&);
+
+            public:
+                explicit scope(operation op) : _op(op), _start(cycles()) {}
+
+                ~scope() { local().record(this->_op, cycles() - this->_start); }
+        };
+    }
+}
+
+#define FT_TRACE_SCOPE(op) ft::trace::scope ft_trace_scope_(ft::trace::op)
+#define FT_TRACE_REALLOCATION() (++ft::trace::local().reallocations)
+#define FT_TRACE_CONSTRUCTED(n) (ft::trace::local().constructed += (n))
+#define FT_TRACE_DESTROYED(n) (ft::trace::local().destroyed += (n))
+
+#else
+
+#define FT_TRACE_SCOPE(op)
+#define FT_TRACE_REALLOCATION() ((void)0)
+#define FT_TRACE_CONSTRUCTED(n) ((void)0)
+#define FT_TRACE_DESTROYED(n) ((void)0)
+
+#endif
+
+#endif
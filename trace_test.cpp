@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_test.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "trace.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <pthread.h>
+#include <string>
+
+#include "vector.hpp"
+
+#ifdef FT_CONTAINERS_TRACE
+namespace {
+    void* reserve_in_thread(void* result) {
+        ft::vector< int > vec;
+        vec.reserve(100);
+        *static_cast< unsigned long* >(result) = ft::trace::local().reallocations;
+        return ft::u_nullptr;
+    }
+}
+#endif
+
+void test_trace(void) {
+    std::cout << "Test: trace" << std::endl;
+#ifdef FT_CONTAINERS_TRACE
+    ft::trace::thread_stats& stats = ft::trace::local();
+    stats.reset();
+    {
+        ft::vector< int > vec;
+        vec.reserve(4);
+        for (int i = 0; i < 8; ++i) {
+            vec.push_back(i);
+        }
+        vec.insert(vec.begin(), 3, 7);
+        vec.erase(vec.begin(), vec.begin() + 2);
+
+        ft::vector< int > other(4, 1);
+        other = vec;
+        vec.assign(3, 5);
+
+        assert(stats.reallocations == 4);
+        assert(stats.constructed == 23);
+        assert(stats.destroyed == 15);
+        assert(stats.operations[ft::trace::RESERVE].calls == 2);
+        assert(stats.operations[ft::trace::INSERT].calls == 1);
+        assert(stats.operations[ft::trace::ERASE].calls == 1);
+        assert(stats.operations[ft::trace::ASSIGN].calls == 1);
+        assert(stats.operations[ft::trace::COPY_ASSIGN].calls == 1);
+    }
+
+    for (unsigned int op = 0; op < ft::trace::OPERATION_COUNT; ++op) {
+        unsigned long total = 0;
+        for (unsigned int i = 0; i < ft::trace::operation_stats::HISTOGRAM_SIZE; ++i) {
+            total += stats.operations[op].histogram[i];
+        }
+        assert(total == stats.operations[op].calls);
+    }
+
+    std::string report = stats.to_json();
+    assert(report.find("\"reallocations\": 4") != std::string::npos);
+    assert(report.find("\"operator=\": {\"calls\": 1") != std::string::npos);
+
+    unsigned long thread_reallocations = 0;
+    pthread_t thread;
+    assert(pthread_create(&thread, ft::u_nullptr, reserve_in_thread, &thread_reallocations) == 0);
+    pthread_join(thread, ft::u_nullptr);
+    assert(thread_reallocations == 1);
+    assert(stats.reallocations == 4);
+#endif
+}
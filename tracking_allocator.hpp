@@ -0,0 +1,296 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tracking_allocator.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _TRACKING_ALLOCATOR_HPP_
+#define _TRACKING_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "memory.hpp"
+#include "util.hpp"
+
+namespace ft {
+
+    /**
+     * @brief Statistiques d'allocation partagées par un tracking_allocator
+     * et toutes ses copies. Les compteurs ne sont pas atomiques : un même
+     * objet ne doit pas être mis à jour par plusieurs threads à la fois.
+     */
+    struct allocation_stats {
+        /* Nombre de classes de taille de l'histogramme : [2^i, 2^(i+1)) octets */
+        static const std::size_t HISTOGRAM_SIZE = 48;
+
+        std::size_t allocations;
+        std::size_t deallocations;
+        /* Octets demandés depuis la création ou le dernier reset */
+        std::size_t bytes_allocated;
+        std::size_t bytes_live;
+        std::size_t peak_bytes;
+        /* Nombre d'allocations par puissance de deux de leur taille en octets */
+        std::size_t histogram[HISTOGRAM_SIZE];
+
+        allocation_stats() { this->reset(); }
+
+        void reset() {
+            this->allocations = 0;
+            this->deallocations = 0;
+            this->bytes_allocated = 0;
+            this->bytes_live = 0;
+            this->peak_bytes = 0;
+            for (std::size_t i = 0; i < HISTOGRAM_SIZE; ++i) {
+                this->histogram[i] = 0;
+            }
+        }
+
+        /**
+         * @brief Classe de taille de bytes : l'indice de son bit de poids fort.
+         */
+        static std::size_t size_class(std::size_t bytes) {
+            std::size_t i = 0;
+            while (bytes > 1 && i + 1 < HISTOGRAM_SIZE) {
+                bytes >>= 1;
+                ++i;
+            }
+            return i;
+        }
+
+        void record_allocate(std::size_t bytes) {
+            ++this->allocations;
+            ++this->histogram[size_class(bytes)];
+            this->bytes_allocated += bytes;
+            this->record_grow(bytes);
+        }
+
+        void record_deallocate(std::size_t bytes) {
+            ++this->deallocations;
+            this->bytes_live -= bytes;
+        }
+
+        /**
+         * @brief Compte bytes de plus dans un bloc déjà vivant, agrandi en place.
+         */
+        void record_grow(std::size_t bytes) {
+            this->bytes_live += bytes;
+            if (this->bytes_live > this->peak_bytes) {
+                this->peak_bytes = this->bytes_live;
+            }
+        }
+
+        /**
+         * @brief Rapport JSON sur une ligne. L'histogramme ne liste que les
+         * classes non vides, sous la forme "borne inférieure en octets": nombre.
+         */
+        std::string to_json() const {
+            std::ostringstream out;
+            out << "{\"allocations\": " << this->allocations
+                << ", \"deallocations\": " << this->deallocations
+                << ", \"bytes_allocated\": " << this->bytes_allocated
+                << ", \"bytes_live\": " << this->bytes_live
+                << ", \"peak_bytes\": " << this->peak_bytes << ", \"histogram\": {";
+            const char* separator = "";
+            for (std::size_t i = 0; i < HISTOGRAM_SIZE; ++i) {
+                if (this->histogram[i]) {
+                    out << separator << "\"" << (static_cast< std::size_t >(1) << i)
+                        << "\": " << this->histogram[i];
+                    separator = ", ";
+                }
+            }
+            out << "}}";
+            return out.str();
+        }
+    };
+
+    /**
+     * @brief Statistiques utilisées par un tracking_allocator construit
+     * sans en préciser.
+     */
+    inline allocation_stats& default_allocation_stats() {
+        static allocation_stats stats;
+        return stats;
+    }
+
+    /**
+     * @brief Allocateur qui délègue à Alloc et enregistre chaque allocation
+     * et libération dans un ft::allocation_stats. Les copies et les
+     * allocateurs reliés (rebind) partagent les mêmes statistiques, si bien
+     * que celles d'un conteneur à noeuds comptent aussi ses noeuds.
+     *
+     * @tparam Alloc Allocateur sous-jacent, par défaut `std::allocator`.
+     */
+    template < class Alloc >
+    class tracking_allocator {
+        public:
+            typedef typename Alloc::value_type value_type;
+            typedef typename Alloc::pointer pointer;
+            typedef typename Alloc::const_pointer const_pointer;
+            typedef typename Alloc::reference reference;
+            typedef typename Alloc::const_reference const_reference;
+            typedef typename Alloc::size_type size_type;
+            typedef typename Alloc::difference_type difference_type;
+
+            template < class U >
+            struct rebind {
+                typedef tracking_allocator< typename Alloc::template rebind< U >::other > other;
+            };
+
+        private:
+            template < class A >
+            friend class tracking_allocator;
+
+            Alloc _alloc;
+            allocation_stats* _stats;
+
+        public:
+            explicit tracking_allocator(allocation_stats& stats = default_allocation_stats(),
+                                        const Alloc& alloc = Alloc())
+                : _alloc(alloc), _stats(&stats) {}
+
+            tracking_allocator(const tracking_allocator& other)
+                : _alloc(other._alloc), _stats(other._stats) {}
+
+            template < class A >
+            tracking_allocator(const tracking_allocator< A >& other)
+                : _alloc(other._alloc), _stats(other._stats) {}
+
+            ~tracking_allocator() {}
+
+            tracking_allocator& operator=(const tracking_allocator& other) {
+                this->_alloc = other._alloc;
+                this->_stats = other._stats;
+                return *this;
+            }
+
+            pointer address(reference x) const { return this->_alloc.address(x); }
+
+            const_pointer address(const_reference x) const { return this->_alloc.address(x); }
+
+            pointer allocate(size_type n, const void* hint = 0) {
+                pointer p = this->_alloc.allocate(n, hint);
+                this->_stats->record_allocate(n * sizeof(value_type));
+                return p;
+            }
+
+            /**
+             * @brief Libère p. Un pointeur nul, que les conteneurs rendent
+             * parfois avec une capacité de 0, n'est pas compté.
+             */
+            void deallocate(pointer p, size_type n) {
+                if (p != pointer()) {
+                    this->_stats->record_deallocate(n * sizeof(value_type));
+                }
+                this->_alloc.deallocate(p, n);
+            }
+
+            /**
+             * @brief Agrandit en place par l'allocateur sous-jacent, et compte
+             * les octets gagnés si l'extension réussit.
+             */
+            bool try_expand(pointer p, size_type old_n, size_type new_n) {
+                if (!ft::allocator_expansion< Alloc >::try_expand(this->_alloc, p, old_n, new_n)) {
+                    return false;
+                }
+                this->_stats->record_grow((new_n - old_n) * sizeof(value_type));
+                return true;
+            }
+
+            /**
+             * @brief Alloue au moins n éléments par l'allocateur sous-jacent, et
+             * compte la capacité réellement obtenue.
+             */
+            pointer allocate_at_least(size_type n, size_type& count) {
+                pointer p = ft::allocator_expansion< Alloc >::allocate_at_least(this->_alloc, n,
+                                                                                count);
+                this->_stats->record_allocate(count * sizeof(value_type));
+                return p;
+            }
+
+            /**
+             * @brief Déplace le bloc par l'allocateur sous-jacent, compté comme
+             * la libération de l'ancien bloc et l'allocation du nouveau.
+             */
+            pointer reallocate(pointer p, size_type old_n, size_type new_n, size_type& count) {
+                pointer next = ft::allocator_expansion< Alloc >::reallocate(this->_alloc, p, old_n,
+                                                                            new_n, count);
+                this->_stats->record_deallocate(old_n * sizeof(value_type));
+                this->_stats->record_allocate(count * sizeof(value_type));
+                return next;
+            }
+
+            size_type max_size() const { return this->_alloc.max_size(); }
+
+#ifdef FT_CONTAINERS_CXX11
+            template < class U, class... Args >
+            void construct(U* p, Args&&... args) {
+                typedef typename std::allocator_traits< Alloc >::template rebind_alloc< U >
+                    alloc_u;
+                alloc_u alloc(this->_alloc);
+                std::allocator_traits< alloc_u >::construct(alloc, p,
+                                                            std::forward< Args >(args)...);
+            }
+
+            template < class U >
+            void destroy(U* p) {
+                p->~U();
+            }
+#else
+            void construct(pointer p, const_reference val) { this->_alloc.construct(p, val); }
+
+            void destroy(pointer p) { this->_alloc.destroy(p); }
+#endif
+
+            allocation_stats& stats() const { return *this->_stats; }
+
+            const Alloc& underlying() const { return this->_alloc; }
+    };
+
+    template < class A1, class A2 >
+    bool operator==(const tracking_allocator< A1 >& lhs, const tracking_allocator< A2 >& rhs) {
+        return &lhs.stats() == &rhs.stats() && lhs.underlying() == rhs.underlying();
+    }
+
+    template < class A1, class A2 >
+    bool operator!=(const tracking_allocator< A1 >& lhs, const tracking_allocator< A2 >& rhs) {
+        return !(lhs == rhs);
+    }
+
+    /**
+     * @brief Les extensions d'un tracking_allocator passent par son
+     * allocateur sous-jacent.
+     */
+    template < class Alloc >
+    struct allocator_expansion< tracking_allocator< Alloc > > {
+        typedef typename tracking_allocator< Alloc >::pointer pointer;
+        typedef typename tracking_allocator< Alloc >::size_type size_type;
+
+        static const bool can_reallocate = ft::allocator_expansion< Alloc >::can_reallocate;
+
+        static bool try_expand(tracking_allocator< Alloc >& alloc, pointer p, size_type old_n,
+                            size_type new_n) {
+            return alloc.try_expand(p, old_n, new_n);
+        }
+
+        static pointer allocate_at_least(tracking_allocator< Alloc >& alloc, size_type n,
+                                        size_type& count) {
+            return alloc.allocate_at_least(n, count);
+        }
+
+        static pointer reallocate(tracking_allocator< Alloc >& alloc, pointer p, size_type old_n,
+                                size_type new_n, size_type& count) {
+            return alloc.reallocate(p, old_n, new_n, count);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tracking_allocator_test.cpp                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tracking_allocator.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "map.hpp"
+#include "vector.hpp"
+
+void test_tracking_allocator(void) {
+    std::cout << "Test: tracking_allocator" << std::endl;
+
+    typedef ft::tracking_allocator< std::allocator< int > > int_alloc;
+
+    ft::allocation_stats stats;
+    {
+        ft::vector< int, int_alloc > vec((int_alloc(stats)));
+        for (int i = 0; i < 1000; ++i) {
+            vec.push_back(i);
+        }
+        assert(stats.bytes_live == vec.memory_footprint());
+        assert(vec.memory_footprint() == vec.capacity() * sizeof(int));
+        assert(stats.allocations == stats.deallocations + 1);
+        assert(stats.peak_bytes >= stats.bytes_live);
+        assert(stats.bytes_allocated >= stats.peak_bytes);
+
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < ft::allocation_stats::HISTOGRAM_SIZE; ++i) {
+            total += stats.histogram[i];
+        }
+        assert(total == stats.allocations);
+
+        ft::vector< int, int_alloc > copy(vec);
+        assert(copy.get_allocator() == vec.get_allocator());
+        assert(stats.bytes_live == vec.memory_footprint() + copy.memory_footprint());
+    }
+    assert(stats.bytes_live == 0);
+    assert(stats.allocations == stats.deallocations);
+
+    assert(ft::allocation_stats::size_class(1) == 0);
+    assert(ft::allocation_stats::size_class(64) == 6);
+    assert(ft::allocation_stats::size_class(127) == 6);
+
+    stats.reset();
+    {
+        ft::vector< int, int_alloc > vec(10, 1, int_alloc(stats));
+        vec.reserve(40);
+        std::string report = stats.to_json();
+        assert(report.find("\"allocations\": 2") != std::string::npos);
+        assert(report.find("\"bytes_live\": 160") != std::string::npos);
+        assert(report.find("\"peak_bytes\": 200") != std::string::npos);
+        assert(report.find("\"histogram\": {\"32\": 1, \"128\": 1}") != std::string::npos);
+    }
+
+    typedef ft::tracking_allocator< std::allocator< ft::pair< const int, std::string > > >
+        pair_alloc;
+    ft::allocation_stats map_stats;
+    {
+        std::less< int > comp;
+        ft::map< int, std::string, std::less< int >, pair_alloc > tree(comp, pair_alloc(map_stats));
+        for (int i = 0; i < 100; ++i) {
+            tree[i] = "node";
+        }
+        assert(map_stats.allocations > 0);
+        assert(map_stats.bytes_live > 0);
+        tree.clear();
+    }
+    assert(map_stats.bytes_live == 0);
+    assert(map_stats.allocations == map_stats.deallocations);
+
+    int_alloc other;
+    assert(&other.stats() == &ft::default_allocation_stats());
+    assert(other != int_alloc(stats));
+}
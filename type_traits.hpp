@@ -13,6 +13,8 @@
 #ifndef _TYPE_TRAITS_HPP_
 #define _TYPE_TRAITS_HPP_
 
+#include <cstddef>
+
 namespace ft {
 
     /**
@@ -58,10 +60,12 @@ namespace ft {
     struct is_integral< bool > : public true_type {};
     template <>
     struct is_integral< char > : public true_type {};
+#if __cplusplus >= 201103L
     template <>
     struct is_integral< char16_t > : public true_type {};
     template <>
     struct is_integral< char32_t > : public true_type {};
+#endif
     template <>
     struct is_integral< wchar_t > : public true_type {};
     template <>
@@ -85,6 +89,164 @@ namespace ft {
     // template <>
     // struct is_integral< unsigned long long int > : public true_type {};
 
+    /**
+     * @brief Type T sans ses qualificatifs const et volatile.
+     */
+    template < class T >
+    struct remove_cv {
+        typedef T type;
+    };
+
+    template < class T >
+    struct remove_cv< const T > {
+        typedef T type;
+    };
+
+    template < class T >
+    struct remove_cv< volatile T > {
+        typedef T type;
+    };
+
+    template < class T >
+    struct remove_cv< const volatile T > {
+        typedef T type;
+    };
+
+    /**
+     * @brief Vérifie si T et U désignent le même type.
+     */
+    template < class T, class U >
+    struct is_same : public false_type {};
+
+    template < class T >
+    struct is_same< T, T > : public true_type {};
+
+    /**
+     * @brief Type T si B est vrai, F sinon.
+     */
+    template < bool B, class T, class F >
+    struct conditional {
+        typedef T type;
+    };
+
+    template < class T, class F >
+    struct conditional< false, T, F > {
+        typedef F type;
+    };
+
+    /**
+     * @brief true_type si B est vrai, false_type sinon.
+     */
+    template < bool B >
+    struct bool_constant : public false_type {};
+
+    template <>
+    struct bool_constant< true > : public true_type {};
+
+    /**
+     * @brief Vérifie si un objet de type T peut être déplacé vers une autre
+     * adresse par une simple copie de ses octets (memcpy / memmove), l'ancien
+     * emplacement étant ensuite considéré comme non construit.
+     * Utilise le builtin du compilateur quand il existe, sinon seuls les types
+     * intégraux et les pointeurs sont reconnus. Un type utilisateur peut
+     * l'activer en spécialisant ce trait :
+     *
+     * template <>
+     * struct is_trivially_relocatable< my_type > : public true_type {};
+     *
+     * @tparam T type à tester
+     */
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+    template < class T >
+    struct is_trivially_relocatable
+        : public bool_constant< __is_trivially_copyable(T) > {};
+#else
+    template < class T >
+    struct is_trivially_relocatable : public bool_constant< is_integral< T >::value > {};
+
+    template < class T >
+    struct is_trivially_relocatable< T* > : public true_type {};
+
+    template <>
+    struct is_trivially_relocatable< float > : public true_type {};
+    template <>
+    struct is_trivially_relocatable< double > : public true_type {};
+    template <>
+    struct is_trivially_relocatable< long double > : public true_type {};
+#endif
+
+    /**
+     * @brief Vérifie si un T peut être copié, affecté et détruit par une
+     * simple copie de ses octets (memcpy), sans appeler de fonction membre.
+     * Contrairement à is_trivially_relocatable, ce trait n'est pas destiné
+     * à être spécialisé : il décrit la copie, pas seulement le déplacement.
+     *
+     * @tparam T type à tester
+     */
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+    template < class T >
+    struct is_trivially_copyable : public bool_constant< __is_trivially_copyable(T) > {};
+#else
+    template < class T >
+    struct is_trivially_copyable : public bool_constant< is_integral< T >::value > {};
+
+    template < class T >
+    struct is_trivially_copyable< T* > : public true_type {};
+
+    template <>
+    struct is_trivially_copyable< float > : public true_type {};
+    template <>
+    struct is_trivially_copyable< double > : public true_type {};
+    template <>
+    struct is_trivially_copyable< long double > : public true_type {};
+#endif
+
+    /**
+     * @brief Alignement requis par T, calculé sans alignof à partir du
+     * remplissage inséré devant un T placé après un char.
+     *
+     * @tparam T type à tester
+     */
+    template < class T >
+    struct alignment_of {
+    private:
+        struct padded {
+            char c;
+            T t;
+        };
+
+    public:
+        static const std::size_t value = sizeof(padded) - sizeof(T);
+    };
+
+    /**
+     * @brief Vérifie si l'égalité de deux T équivaut à l'égalité de leurs
+     * octets, ce qui permet de comparer des intervalles avec memcmp.
+     * Vrai pour les types intégraux et les pointeurs.
+     *
+     * @tparam T type à tester
+     */
+    template < class T >
+    struct is_bytewise_equality_comparable
+        : public is_integral< typename remove_cv< T >::type > {};
+
+    template < class T >
+    struct is_bytewise_equality_comparable< T* > : public true_type {};
+
+    /**
+     * @brief Vérifie si l'ordre de deux T équivaut à l'ordre de memcmp,
+     * qui compare les octets comme des unsigned char. Vrai pour unsigned char,
+     * et pour char quand il est non signé sur la plateforme.
+     *
+     * @tparam T type à tester
+     */
+    template < class T >
+    struct is_bytewise_less_comparable
+        : public bool_constant<
+            is_same< typename remove_cv< T >::type, unsigned char >::value ||
+            (is_same< typename remove_cv< T >::type, char >::value &&
+            static_cast< char >(-1) > 0) > {};
+
 }
 
 #endif
@@ -0,0 +1,751 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_flat_map.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _UNORDERED_FLAT_MAP_HPP_
+#define _UNORDERED_FLAT_MAP_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include "hash.hpp"
+#include "iterator.hpp"
+#include "memory.hpp"
+#include "simd.hpp"
+#include "type_traits.hpp"
+#include "util.hpp"
+#include "utility.hpp"
+
+namespace ft {
+
+    /*
+    Octets de contrôle : un emplacement occupé porte les 7 bits de poids
+    faible du hachage de sa clé (0 à 127), les autres valeurs sont négatives.
+    La sentinelle, placée après le dernier emplacement, arrête les itérateurs.
+    */
+    static const signed char FLAT_HASH_EMPTY = -128;
+    static const signed char FLAT_HASH_DELETED = -2;
+    static const signed char FLAT_HASH_SENTINEL = -1;
+
+    /**
+     * @brief Itérateur avant sur les emplacements occupés d'une table de
+     * hachage ouverte : un octet de contrôle et l'emplacement correspondant.
+     *
+     * @tparam T Type de valeur des emplacements, éventuellement const.
+     */
+    template < class T >
+    class flat_hash_iterator : public ft::iterator< ft::forward_iterator_tag, T > {
+        public:
+            typedef typename ft::iterator< ft::forward_iterator_tag, T >::iterator_category
+                iterator_category;
+            typedef typename ft::iterator< ft::forward_iterator_tag, T >::value_type
+                value_type;
+            typedef typename ft::iterator< ft::forward_iterator_tag, T >::difference_type
+                difference_type;
+            typedef typename ft::iterator< ft::forward_iterator_tag, T >::pointer pointer;
+            typedef typename ft::iterator< ft::forward_iterator_tag, T >::reference
+                reference;
+
+        protected:
+            const signed char* _ctrl;
+            T* _slot;
+
+        public:
+            /**
+             * @brief constructeur par défaut
+             */
+            flat_hash_iterator(const signed char* ctrl = ft::u_nullptr, T* slot = ft::u_nullptr)
+                : _ctrl(ctrl), _slot(slot) {}
+
+            /**
+             * @brief copy / type-cast constructeur
+             */
+            flat_hash_iterator(const flat_hash_iterator& other)
+                : _ctrl(other._ctrl), _slot(other._slot) {}
+
+            /**
+             * @brief opérateur d'affectation
+             */
+            flat_hash_iterator& operator=(const flat_hash_iterator& other) {
+                this->_ctrl = other._ctrl;
+                this->_slot = other._slot;
+                return *this;
+            }
+
+            /**
+             * @brief flat_hash_iterator< const T > casting operator
+             */
+            operator flat_hash_iterator< const T >() const {
+                return flat_hash_iterator< const T >(this->_ctrl, this->_slot);
+            }
+
+            /**
+             * @brief Avance jusqu'au prochain emplacement occupé ou jusqu'à
+             * la sentinelle.
+             */
+            flat_hash_iterator& operator++() {
+                ++this->_ctrl;
+                ++this->_slot;
+                this->skip_free();
+                return *this;
+            }
+
+            flat_hash_iterator operator++(int) {
+                flat_hash_iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            reference operator*() const { return *this->_slot; }
+
+            pointer operator->() const { return this->_slot; }
+
+            /**
+             * @brief Saute les emplacements vides ou supprimés, dont l'octet
+             * de contrôle est inférieur à celui de la sentinelle.
+             */
+            void skip_free() {
+                while (*this->_ctrl < FLAT_HASH_SENTINEL) {
+                    ++this->_ctrl;
+                    ++this->_slot;
+                }
+            }
+
+            const signed char* ctrl() const { return this->_ctrl; }
+    };
+
+    /**
+     * @brief Opérateurs relationnels == et != pour flat_hash_iterator,
+     * entre itérateurs constants ou non.
+     */
+    template < class T1, class T2 >
+    bool operator==(const flat_hash_iterator< T1 >& lhs, const flat_hash_iterator< T2 >& rhs) {
+        return lhs.ctrl() == rhs.ctrl();
+    }
+
+    template < class T1, class T2 >
+    bool operator!=(const flat_hash_iterator< T1 >& lhs, const flat_hash_iterator< T2 >& rhs) {
+        return lhs.ctrl() != rhs.ctrl();
+    }
+
+    /**
+     * @brief Conteneur associatif non ordonné de paires clé / valeur à clés
+     * uniques, implémenté par une table de hachage ouverte à la manière des
+     * Swiss tables.
+     * Les paires sont rangées dans un seul tableau, et un tableau parallèle
+     * d'octets de contrôle garde pour chaque emplacement 7 bits du hachage
+     * de sa clé. Les emplacements sont sondés par groupes de 16 : un groupe
+     * est comparé en une instruction SSE2 aux 7 bits cherchés, et seules les
+     * clés dont l'octet correspond sont comparées. Le nombre de groupes est
+     * une puissance de deux, parcourue par sondage triangulaire, et la table
+     * est remplie au plus aux 7/8.
+     * insert peut réhacher et invalide alors les itérateurs ; erase
+     * n'invalide que l'itérateur supprimé.
+     *
+     * @tparam Key Type des clés.
+     * @tparam T Type des valeurs associées.
+     * @tparam Hash Fonction de hachage, par défaut `ft::hash<Key>`.
+     * @tparam KeyEqual Égalité des clés, par défaut `std::equal_to<Key>`.
+     * @tparam Alloc Allocateur de `pair<const Key, T>`.
+     */
+    template < class Key, class T, class Hash = ft::hash< Key >,
+            class KeyEqual = std::equal_to< Key >,
+            class Alloc = std::allocator< ft::pair< const Key, T > > >
+    class unordered_flat_map {
+        public:
+            /* Le premier paramètre du template (Key) */
+            typedef Key key_type;
+            /* Le deuxième paramètre du template (T) */
+            typedef T mapped_type;
+            /* pair<const key_type, mapped_type> */
+            typedef ft::pair< const key_type, mapped_type > value_type;
+            /* Le troisième paramètre du template (Hash) */
+            typedef Hash hasher;
+            /* Le quatrième paramètre du template (KeyEqual) */
+            typedef KeyEqual key_equal;
+            /* Le cinquième paramètre du template (Alloc) */
+            typedef Alloc allocator_type;
+            typedef typename allocator_type::reference reference;
+            typedef typename allocator_type::const_reference const_reference;
+            typedef typename allocator_type::pointer pointer;
+            typedef typename allocator_type::const_pointer const_pointer;
+            typedef typename allocator_type::size_type size_type;
+            typedef typename allocator_type::difference_type difference_type;
+
+            /* un itérateur avant sur value_type */
+            typedef ft::flat_hash_iterator< value_type > iterator;
+            /* un itérateur avant sur const value_type */
+            typedef ft::flat_hash_iterator< const value_type > const_iterator;
+
+        private:
+            typedef typename allocator_type::template rebind< signed char >::other ctrl_allocator;
+
+            /* Nombre d'emplacements d'un groupe */
+            static const size_type GROUP_WIDTH = 16;
+
+            hasher _hash;
+            key_equal _eq;
+            allocator_type _alloc;
+            ctrl_allocator _ctrl_alloc;
+            signed char* _ctrl;
+            pointer _slots;
+            size_type _capacity;
+            size_type _size;
+            /* Emplacements vides encore utilisables avant d'atteindre 7/8 */
+            size_type _growth_left;
+
+        public:
+            /**
+             * @brief constructeur de conteneur vide, dimensionné pour
+             * recevoir n éléments sans réhacher.
+             */
+            explicit unordered_flat_map(size_type n = 0, const hasher& hf = hasher(),
+                                        const key_equal& eql = key_equal(),
+                                        const allocator_type& alloc = allocator_type())
+                : _hash(hf), _eq(eql), _alloc(alloc), _ctrl_alloc(alloc), _ctrl(u_nullptr),
+                _slots(u_nullptr), _capacity(0), _size(0), _growth_left(0) {
+                this->reserve(n);
+            }
+
+            /**
+             * @brief constructeur d'intervalle
+             */
+            template < class InputIterator >
+            unordered_flat_map(InputIterator first, InputIterator last, size_type n = 0,
+                            const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+                            const allocator_type& alloc = allocator_type())
+                : _hash(hf), _eq(eql), _alloc(alloc), _ctrl_alloc(alloc), _ctrl(u_nullptr),
+                _slots(u_nullptr), _capacity(0), _size(0), _growth_left(0) {
+                this->reserve(n);
+                this->insert(first, last);
+            }
+
+            /**
+             * @brief constructeur par copie
+             * Les éléments sont recopiés aux mêmes emplacements, sans
+             * recalculer leur hachage.
+             */
+            unordered_flat_map(const unordered_flat_map& x)
+                : _hash(x._hash), _eq(x._eq), _alloc(x._alloc), _ctrl_alloc(x._ctrl_alloc),
+                _ctrl(u_nullptr), _slots(u_nullptr), _capacity(0), _size(0), _growth_left(0) {
+                if (x._size == 0) {
+                    return;
+                }
+                this->_allocate(x._capacity);
+                size_type i = 0;
+                try {
+                    for (; i < x._capacity; ++i) {
+                        if (x._ctrl[i] >= 0) {
+                            this->_alloc.construct(this->_slots + i, x._slots[i]);
+                        }
+                    }
+                }
+                catch (...) {
+                    for (size_type j = 0; j < i; ++j) {
+                        if (x._ctrl[j] >= 0) {
+                            this->_alloc.destroy(this->_slots + j);
+                        }
+                    }
+                    this->_deallocate();
+                    throw;
+                }
+                std::memcpy(this->_ctrl, x._ctrl, x._capacity);
+                this->_size = x._size;
+                this->_growth_left = x._growth_left;
+            }
+
+            unordered_flat_map& operator=(const unordered_flat_map& x) {
+                if (this != &x) {
+                    unordered_flat_map tmp(x);
+                    this->swap(tmp);
+                }
+                return *this;
+            }
+
+            ~unordered_flat_map() {
+                this->_destroy_all();
+                this->_deallocate();
+            }
+
+            iterator begin() {
+                if (this->_size == 0) {
+                    return this->end();
+                }
+                iterator it(this->_ctrl, this->_slots);
+                it.skip_free();
+                return it;
+            }
+
+            const_iterator begin() const {
+                return const_cast< unordered_flat_map* >(this)->begin();
+            }
+
+            iterator end() {
+                return iterator(this->_ctrl + this->_capacity, this->_slots + this->_capacity);
+            }
+
+            const_iterator end() const {
+                return const_cast< unordered_flat_map* >(this)->end();
+            }
+
+            bool empty() const { return this->_size == 0; }
+
+            size_type size() const { return this->_size; }
+
+            size_type max_size() const { return this->_alloc.max_size(); }
+
+            /**
+             * @brief Accès à l'élément de clé k, inséré avec une valeur par
+             * défaut s'il n'existe pas.
+             */
+            mapped_type& operator[](const key_type& k) {
+                size_type h = this->_hash(k);
+                size_type i = this->_find_index(k, h);
+                if (i == this->_capacity) {
+                    i = this->_insert_new(value_type(k, mapped_type()), h);
+                }
+                return this->_slots[i].second;
+            }
+
+            /**
+             * @brief Accès à l'élément de clé k, std::out_of_range s'il n'existe pas.
+             */
+            mapped_type& at(const key_type& k) {
+                iterator it = this->find(k);
+                if (it == this->end()) {
+                    throw std::out_of_range("ft::unordered_flat_map");
+                }
+                return it->second;
+            }
+
+            const mapped_type& at(const key_type& k) const {
+                const_iterator it = this->find(k);
+                if (it == this->end()) {
+                    throw std::out_of_range("ft::unordered_flat_map");
+                }
+                return it->second;
+            }
+
+            /**
+             * @brief Insère val si sa clé est absente.
+             * Renvoie l'élément de même clé et true s'il a été inséré.
+             */
+            ft::pair< iterator, bool > insert(const value_type& val) {
+                size_type h = this->_hash(val.first);
+                size_type i = this->_find_index(val.first, h);
+                if (i != this->_capacity) {
+                    return ft::make_pair(this->_iterator_at(i), false);
+                }
+                i = this->_insert_new(val, h);
+                return ft::make_pair(this->_iterator_at(i), true);
+            }
+
+            /**
+             * @brief Insère val ; position n'est qu'une indication ignorée.
+             */
+            iterator insert(const_iterator position, const value_type& val) {
+                (void)position;
+                return this->insert(val).first;
+            }
+
+            /**
+             * @brief Insère les éléments de [first, last), en réservant d'abord
+             * la place de tous pour des itérateurs multi-passes.
+             */
+            template < class InputIterator >
+            void insert(InputIterator first, InputIterator last) {
+                this->_reserve_range(first, last,
+                                    typename ft::iterator_category_of< InputIterator >::type());
+                for (; first != last; ++first) {
+                    this->insert(*first);
+                }
+            }
+
+            /**
+             * @brief Supprime l'élément désigné par position.
+             * L'emplacement redevient vide si son groupe contient déjà un
+             * emplacement vide, aucune recherche n'ayant alors pu le traverser ;
+             * sinon il est marqué supprimé pour ne pas couper les sondages.
+             */
+            void erase(const_iterator position) {
+                this->_erase_at(static_cast< size_type >(position.ctrl() - this->_ctrl));
+            }
+
+            size_type erase(const key_type& k) {
+                size_type i = this->_find_index(k, this->_hash(k));
+                if (i == this->_capacity) {
+                    return 0;
+                }
+                this->_erase_at(i);
+                return 1;
+            }
+
+            void erase(const_iterator first, const_iterator last) {
+                while (first != last) {
+                    this->erase(first++);
+                }
+            }
+
+            /**
+             * @brief Détruit tous les éléments en gardant la capacité.
+             */
+            void clear() {
+                if (this->_capacity == 0) {
+                    return;
+                }
+                this->_destroy_all();
+                std::memset(this->_ctrl, FLAT_HASH_EMPTY, this->_capacity);
+                this->_size = 0;
+                this->_growth_left = _max_load(this->_capacity);
+            }
+
+            /**
+             * @brief Echange de contenu en temps constant
+             */
+            void swap(unordered_flat_map& x) {
+                ft::swap(this->_hash, x._hash);
+                ft::swap(this->_eq, x._eq);
+                ft::swap(this->_ctrl, x._ctrl);
+                ft::swap(this->_slots, x._slots);
+                ft::swap(this->_capacity, x._capacity);
+                ft::swap(this->_size, x._size);
+                ft::swap(this->_growth_left, x._growth_left);
+            }
+
+            iterator find(const key_type& k) {
+                return this->_iterator_at(this->_find_index(k, this->_hash(k)));
+            }
+
+            const_iterator find(const key_type& k) const {
+                return const_cast< unordered_flat_map* >(this)->find(k);
+            }
+
+            size_type count(const key_type& k) const {
+                return this->find(k) == this->end() ? 0 : 1;
+            }
+
+            ft::pair< iterator, iterator > equal_range(const key_type& k) {
+                iterator it = this->find(k);
+                if (it == this->end()) {
+                    return ft::make_pair(it, it);
+                }
+                iterator next = it;
+                return ft::make_pair(it, ++next);
+            }
+
+            ft::pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+                ft::pair< iterator, iterator > range =
+                    const_cast< unordered_flat_map* >(this)->equal_range(k);
+                return ft::make_pair(const_iterator(range.first), const_iterator(range.second));
+            }
+
+            /**
+             * @brief Nombre d'emplacements de la table.
+             */
+            size_type bucket_count() const { return this->_capacity; }
+
+            float load_factor() const {
+                return this->_capacity ? static_cast< float >(this->_size) / this->_capacity : 0.0f;
+            }
+
+            /**
+             * @brief Taux de remplissage maximal, fixé à 7/8.
+             */
+            float max_load_factor() const { return 0.875f; }
+
+            /**
+             * @brief Réhache vers au moins n emplacements, et assez pour
+             * contenir les éléments actuels.
+             */
+            void rehash(size_type n) {
+                size_type capacity = _capacity_for(this->_size);
+                while (capacity < n) {
+                    capacity *= 2;
+                }
+                if (capacity != this->_capacity) {
+                    this->_rehash(capacity);
+                }
+            }
+
+            /**
+             * @brief Dimensionne la table pour n éléments sans réhacher.
+             */
+            void reserve(size_type n) {
+                if (n > this->_size + this->_growth_left) {
+                    this->_rehash(_capacity_for(n));
+                }
+            }
+
+            hasher hash_function() const { return this->_hash; }
+
+            key_equal key_eq() const { return this->_eq; }
+
+            allocator_type get_allocator() const { return this->_alloc; }
+
+        private:
+            /**
+             * @brief Nombre d'éléments admis dans capacity emplacements (7/8).
+             */
+            static size_type _max_load(size_type capacity) { return capacity - capacity / 8; }
+
+            /**
+             * @brief Plus petite capacité, puissance de deux d'au moins un
+             * groupe, pouvant contenir n éléments.
+             */
+            static size_type _capacity_for(size_type n) {
+                size_type capacity = GROUP_WIDTH;
+                while (_max_load(capacity) < n) {
+                    capacity *= 2;
+                }
+                return capacity;
+            }
+
+            iterator _iterator_at(size_type i) {
+                return iterator(this->_ctrl + i, this->_slots + i);
+            }
+
+            /**
+             * @brief Position de la clé k de hachage h, ou _capacity si elle
+             * est absente. Le sondage s'arrête au premier groupe qui contient
+             * un emplacement vide.
+             */
+            size_type _find_index(const key_type& k, size_type h) const {
+                if (this->_capacity == 0) {
+                    return 0;
+                }
+                size_type group_mask = this->_capacity / GROUP_WIDTH - 1;
+                size_type group = (h >> 7) & group_mask;
+                signed char h2 = static_cast< signed char >(h & 0x7f);
+                for (size_type step = 1;; ++step) {
+                    const signed char* ctrl = this->_ctrl + group * GROUP_WIDTH;
+                    for (unsigned mask = ft::simd::group_match(ctrl, h2); mask;
+                        mask &= mask - 1) {
+                        size_type i = group * GROUP_WIDTH + __builtin_ctz(mask);
+                        if (this->_eq(this->_slots[i].first, k)) {
+                            return i;
+                        }
+                    }
+                    if (ft::simd::group_match(ctrl, FLAT_HASH_EMPTY)) {
+                        return this->_capacity;
+                    }
+                    group = (group + step) & group_mask;
+                }
+            }
+
+            /**
+             * @brief Premier emplacement vide ou supprimé de la séquence de
+             * sondage de h dans une table de capacity emplacements.
+             */
+            static size_type _find_free(const signed char* ctrl, size_type capacity, size_type h) {
+                size_type group_mask = capacity / GROUP_WIDTH - 1;
+                size_type group = (h >> 7) & group_mask;
+                for (size_type step = 1;; ++step) {
+                    unsigned mask = ft::simd::group_match_negative(ctrl + group * GROUP_WIDTH);
+                    if (mask) {
+                        return group * GROUP_WIDTH + __builtin_ctz(mask);
+                    }
+                    group = (group + step) & group_mask;
+                }
+            }
+
+            /**
+             * @brief Construit val, de hachage h et absente de la table, dans
+             * un emplacement libre, en réhachant d'abord si la table a atteint
+             * son remplissage maximal. Renvoie sa position.
+             */
+            size_type _insert_new(const value_type& val, size_type h) {
+                size_type i = this->_capacity ? _find_free(this->_ctrl, this->_capacity, h) : 0;
+                if (this->_capacity == 0 ||
+                    (this->_growth_left == 0 && this->_ctrl[i] == FLAT_HASH_EMPTY)) {
+                    this->_grow();
+                    i = _find_free(this->_ctrl, this->_capacity, h);
+                }
+                this->_alloc.construct(this->_slots + i, val);
+                if (this->_ctrl[i] == FLAT_HASH_EMPTY) {
+                    --this->_growth_left;
+                }
+                this->_ctrl[i] = static_cast< signed char >(h & 0x7f);
+                ++this->_size;
+                return i;
+            }
+
+            /**
+             * @brief Fait de la place : double la capacité, ou réhache à
+             * capacité égale si la table est surtout encombrée d'emplacements
+             * supprimés.
+             */
+            void _grow() {
+                if (this->_capacity == 0) {
+                    this->_rehash(GROUP_WIDTH);
+                } else if (this->_size + 1 <= _max_load(this->_capacity) / 2) {
+                    this->_rehash(this->_capacity);
+                } else {
+                    this->_rehash(this->_capacity * 2);
+                }
+            }
+
+            void _erase_at(size_type i) {
+                this->_alloc.destroy(this->_slots + i);
+                const signed char* group = this->_ctrl + (i & ~(GROUP_WIDTH - 1));
+                if (ft::simd::group_match(group, FLAT_HASH_EMPTY)) {
+                    this->_ctrl[i] = FLAT_HASH_EMPTY;
+                    ++this->_growth_left;
+                } else {
+                    this->_ctrl[i] = FLAT_HASH_DELETED;
+                }
+                --this->_size;
+            }
+
+            template < class InputIterator >
+            void _reserve_range(InputIterator, InputIterator, ft::input_iterator_tag) {}
+
+            template < class ForwardIterator >
+            void _reserve_range(ForwardIterator first, ForwardIterator last,
+                                ft::forward_iterator_tag) {
+                this->reserve(this->_size + static_cast< size_type >(ft::distance(first, last)));
+            }
+
+            /**
+             * @brief Alloue des tableaux vides de capacity emplacements, la
+             * sentinelle comprise.
+             */
+            void _allocate(size_type capacity) {
+                this->_ctrl = this->_ctrl_alloc.allocate(capacity + 1);
+                try {
+                    this->_slots = this->_alloc.allocate(capacity);
+                }
+                catch (...) {
+                    this->_ctrl_alloc.deallocate(this->_ctrl, capacity + 1);
+                    this->_ctrl = u_nullptr;
+                    throw;
+                }
+                std::memset(this->_ctrl, FLAT_HASH_EMPTY, capacity);
+                this->_ctrl[capacity] = FLAT_HASH_SENTINEL;
+                this->_capacity = capacity;
+                this->_growth_left = _max_load(capacity);
+            }
+
+            void _deallocate() {
+                if (this->_capacity == 0) {
+                    return;
+                }
+                this->_ctrl_alloc.deallocate(this->_ctrl, this->_capacity + 1);
+                this->_alloc.deallocate(this->_slots, this->_capacity);
+                this->_ctrl = u_nullptr;
+                this->_slots = u_nullptr;
+                this->_capacity = 0;
+                this->_growth_left = 0;
+            }
+
+            void _destroy_all() {
+                for (size_type i = 0; i < this->_capacity; ++i) {
+                    if (this->_ctrl[i] >= 0) {
+                        this->_alloc.destroy(this->_slots + i);
+                    }
+                }
+            }
+
+            /**
+             * @brief Range tous les éléments dans une nouvelle table de
+             * capacity emplacements. Les types trivialement relogeables sont
+             * copiés octet par octet ; les autres sont copiés puis les
+             * anciens détruits, si bien qu'une exception laisse la table
+             * intacte.
+             */
+            void _rehash(size_type capacity) {
+                unordered_flat_map next(0, this->_hash, this->_eq, this->_alloc);
+                next._allocate(capacity);
+                this->_transfer(next, ft::is_trivially_relocatable< value_type >());
+                next._size = this->_size;
+                next._growth_left -= this->_size;
+                this->_deallocate();
+                this->swap(next);
+            }
+
+            void _transfer(unordered_flat_map& next, ft::true_type) {
+                try {
+                    for (size_type i = 0; i < this->_capacity; ++i) {
+                        if (this->_ctrl[i] >= 0) {
+                            size_type h = this->_hash(this->_slots[i].first);
+                            size_type j = _find_free(next._ctrl, next._capacity, h);
+                            next._ctrl[j] = this->_ctrl[i];
+                            std::memcpy(static_cast< void* >(next._slots + j),
+                                        static_cast< const void* >(this->_slots + i),
+                                        sizeof(value_type));
+                        }
+                    }
+                }
+                catch (...) {
+                    /* les octets copiés appartiennent toujours à la table d'origine */
+                    std::memset(next._ctrl, FLAT_HASH_EMPTY, next._capacity);
+                    throw;
+                }
+            }
+
+            void _transfer(unordered_flat_map& next, ft::false_type) {
+                for (size_type i = 0; i < this->_capacity; ++i) {
+                    if (this->_ctrl[i] >= 0) {
+                        size_type h = this->_hash(this->_slots[i].first);
+                        size_type j = _find_free(next._ctrl, next._capacity, h);
+                        this->_alloc.construct(next._slots + j, this->_slots[i]);
+                        next._ctrl[j] = this->_ctrl[i];
+                        ++next._size;
+                        --next._growth_left;
+                    }
+                }
+                this->_destroy_all();
+                next._size = 0;
+                next._growth_left += this->_size;
+            }
+    };
+
+    /**
+     * @brief Deux tables sont égales si elles ont les mêmes clés associées
+     * aux mêmes valeurs, quel que soit l'ordre de leurs emplacements.
+     */
+    template < class Key, class T, class Hash, class KeyEqual, class Alloc >
+    bool operator==(const unordered_flat_map< Key, T, Hash, KeyEqual, Alloc >& lhs,
+                    const unordered_flat_map< Key, T, Hash, KeyEqual, Alloc >& rhs) {
+        typedef typename unordered_flat_map< Key, T, Hash, KeyEqual, Alloc >::const_iterator
+            const_iterator;
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+            const_iterator other = rhs.find(it->first);
+            if (other == rhs.end() || !(other->second == it->second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template < class Key, class T, class Hash, class KeyEqual, class Alloc >
+    bool operator!=(const unordered_flat_map< Key, T, Hash, KeyEqual, Alloc >& lhs,
+                    const unordered_flat_map< Key, T, Hash, KeyEqual, Alloc >& rhs) {
+        return !(lhs == rhs);
+    }
+
+    /**
+     * @brief Échanger le contenu de deux unordered_flat_map
+     */
+    template < class Key, class T, class Hash, class KeyEqual, class Alloc >
+    void swap(unordered_flat_map< Key, T, Hash, KeyEqual, Alloc >& x,
+            unordered_flat_map< Key, T, Hash, KeyEqual, Alloc >& y) {
+        x.swap(y);
+    }
+}
+
+#endif
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_flat_map_bench.cpp                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "map.hpp"
+#include "unordered_flat_map.hpp"
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 201103L
+#include <unordered_map>
+#define BENCH_STD_UNORDERED_MAP std::unordered_map
+#else
+#include <tr1/unordered_map>
+#define BENCH_STD_UNORDERED_MAP std::tr1::unordered_map
+#endif
+
+#include "bench.hpp"
+
+namespace {
+    /* Nombre de recherches et de tours de suppression chronométrés par taille */
+    const std::size_t OPERATIONS = 1000000;
+
+    double ns_per_op(double start) { return (bench::now_ns() - start) / OPERATIONS; }
+
+    /**
+     * @brief Insertion de n clés paires aléatoires, recherches réussies,
+     * recherches de clés impaires (toujours absentes), puis tours où une
+     * clé présente est supprimée et une nouvelle insérée, avec les mêmes
+     * clés pour chaque conteneur.
+     */
+    template < class Map, class Pair >
+    void bench_hash_size(const char* name, std::size_t n) {
+        std::vector< long > keys(n);
+        bench::lcg rng(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            keys[i] = static_cast< long >(rng.next(n * 8)) * 2;
+        }
+
+        Map m;
+        double start = bench::now_ns();
+        for (std::size_t i = 0; i < n; ++i) {
+            m.insert(Pair(keys[i], static_cast< long >(i)));
+        }
+        double insert_ns = (bench::now_ns() - start) / n;
+
+        long found = 0;
+        start = bench::now_ns();
+        for (std::size_t i = 0; i < OPERATIONS; ++i) {
+            found += m.find(keys[rng.next(n)])->second;
+        }
+        double hit_ns = ns_per_op(start);
+
+        start = bench::now_ns();
+        for (std::size_t i = 0; i < OPERATIONS; ++i) {
+            long key = static_cast< long >(rng.next(n * 8)) * 2 + 1;
+            found += (m.find(key) == m.end()) ? key : 0;
+        }
+        double miss_ns = ns_per_op(start);
+
+        start = bench::now_ns();
+        for (std::size_t i = 0; i < OPERATIONS; ++i) {
+            std::size_t slot = rng.next(n);
+            found += static_cast< long >(m.erase(keys[slot]));
+            keys[slot] = static_cast< long >(rng.next(n * 8)) * 2;
+            m.insert(Pair(keys[slot], static_cast< long >(i)));
+        }
+        double churn_ns = ns_per_op(start);
+
+        std::cout << "\t " << name << " " << n << " keys: insert " << insert_ns << " ns, hit "
+                << hit_ns << " ns, miss " << miss_ns << " ns, erase + insert " << churn_ns
+                << " ns" << (found == -1 ? " " : "") << std::endl;
+    }
+}
+
+void bench_unordered_flat_map(void) {
+    typedef ft::unordered_flat_map< long, long > flat_map;
+    typedef BENCH_STD_UNORDERED_MAP< long, long > std_map;
+    typedef ft::map< long, long > ft_map;
+
+    std::cout << "Bench: unordered_flat_map vs std unordered_map vs map" << std::endl;
+    for (std::size_t n = 1000; n <= 1000000; n *= 10) {
+        bench_hash_size< flat_map, ft::pair< const long, long > >("ft::unordered_flat_map", n);
+        bench_hash_size< std_map, std::pair< const long, long > >("std unordered_map", n);
+        bench_hash_size< ft_map, ft::pair< const long, long > >("ft::map", n);
+    }
+}
@@ -0,0 +1,162 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_flat_map_test.cpp                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "unordered_flat_map.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace {
+    template < class Map, class StdMap >
+    bool same_content(const Map& ft_map, const StdMap& std_map) {
+        if (ft_map.size() != std_map.size()) {
+            return false;
+        }
+        size_t visited = 0;
+        for (typename Map::const_iterator it = ft_map.begin(); it != ft_map.end(); ++it) {
+            typename StdMap::const_iterator std_it = std_map.find(it->first);
+            if (std_it == std_map.end() || std_it->second != it->second) {
+                return false;
+            }
+            ++visited;
+        }
+        return visited == std_map.size();
+    }
+
+    /**
+     * @brief Hachage constant : toutes les clés sondent la même séquence.
+     */
+    struct colliding_hash {
+        size_t operator()(int) const { return 42; }
+    };
+}
+
+void test_flat_hash(void) {
+    std::cout << "\t hash" << std::endl;
+
+    ft::hash< int > int_hash;
+    assert(int_hash(1) != int_hash(2) && int_hash(7) == int_hash(7));
+    assert((int_hash(1) & 0x7f) != (int_hash(2) & 0x7f) || (int_hash(1) >> 7) != (int_hash(2) >> 7));
+
+    ft::hash< std::string > string_hash;
+    std::string text("the quick brown fox jumps");
+    for (size_t len = 0; len < text.size(); ++len) {
+        std::string prefix(text, 0, len);
+        std::string copy(prefix.begin(), prefix.end());
+        assert(string_hash(prefix) == string_hash(copy));
+        if (len > 0) {
+            assert(string_hash(prefix) != string_hash(std::string(text, 0, len - 1)));
+        }
+    }
+}
+
+void test_flat_hash_random(void) {
+    std::cout << "\t random operations" << std::endl;
+
+    ft::unordered_flat_map< int, int > ft_map;
+    std::map< int, int > std_map;
+    unsigned long state = 12345;
+    for (int i = 0; i < 60000; ++i) {
+        state = state * 6364136223846793005UL + 1442695040888963407UL;
+        int key = static_cast< int >((state >> 33) % 5000);
+        if (i % 3 == 2 || (i / 10000) % 2 == 1) {
+            assert(ft_map.erase(key) == std_map.erase(key));
+        } else {
+            bool inserted = ft_map.insert(ft::make_pair(key, i)).second;
+            assert(inserted == std_map.insert(std::make_pair(key, i)).second);
+        }
+        assert(ft_map.count(key) == std_map.count(key));
+        if (i % 4999 == 0) {
+            assert(same_content(ft_map, std_map));
+            assert(ft_map.load_factor() <= ft_map.max_load_factor());
+        }
+    }
+    assert(same_content(ft_map, std_map));
+
+    size_t capacity = ft_map.bucket_count();
+    for (ft::unordered_flat_map< int, int >::iterator it = ft_map.begin(); it != ft_map.end();) {
+        if (it->first % 2) {
+            ft_map.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+    for (std::map< int, int >::iterator it = std_map.begin(); it != std_map.end();) {
+        if (it->first % 2) {
+            std_map.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+    assert(same_content(ft_map, std_map) && ft_map.bucket_count() == capacity);
+    ft_map.clear();
+    assert(ft_map.empty() && ft_map.begin() == ft_map.end() && ft_map.bucket_count() == capacity);
+
+    ft::unordered_flat_map< int, int, colliding_hash > colliding;
+    for (int i = 0; i < 300; ++i) {
+        colliding[i] = i * 2;
+    }
+    for (int i = 0; i < 300; i += 2) {
+        assert(colliding.erase(i) == 1);
+    }
+    for (int i = 0; i < 300; ++i) {
+        assert(colliding.count(i) == static_cast< size_t >(i % 2));
+    }
+    assert(colliding.size() == 150 && colliding.at(299) == 598);
+}
+
+void test_flat_hash_copy(void) {
+    std::cout << "\t copy / swap" << std::endl;
+
+    ft::unordered_flat_map< std::string, std::string > first(100);
+    size_t reserved = first.bucket_count();
+    for (int i = 0; i < 100; ++i) {
+        std::string key(static_cast< size_t >(i % 10) + 1, static_cast< char >('a' + i / 10));
+        first[key] = key + "!";
+    }
+    assert(first.size() == 100 && first.bucket_count() == reserved);
+
+    ft::unordered_flat_map< std::string, std::string > copy(first);
+    assert(copy == first);
+    copy.erase("a");
+    assert(copy != first && copy.find("a") == copy.end() && copy.find("aa") != copy.end());
+    copy["a"] = "a!";
+    assert(copy == first);
+
+    ft::unordered_flat_map< std::string, std::string > other;
+    other["z"] = "zz";
+    ft::swap(other, copy);
+    assert(copy.size() == 1 && other.size() == 100 && copy.begin()->second == "zz");
+
+    other = copy;
+    assert(other == copy);
+    other.insert(first.begin(), first.end());
+    assert(other.size() == 101 && other.at("z") == "zz");
+    other.rehash(4096);
+    assert(other.bucket_count() >= 4096 && other.size() == 101 && other["jjjjjjjjjj"] == "jjjjjjjjjj!");
+
+    try {
+        other.at("missing");
+        assert(false);
+    }
+    catch (const std::out_of_range&) {}
+}
+
+void test_unordered_flat_map(void) {
+    std::cout << "Test: unordered_flat_map" << std::endl;
+
+    test_flat_hash();
+    test_flat_hash_random();
+    test_flat_hash_copy();
+}
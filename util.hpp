@@ -15,6 +15,15 @@
 
 #include "iterator.hpp"
 
+/*
+Couche C++11 (sémantique de déplacement, emplace) : activée seulement
+quand le dialecte la supporte, le code reste compilable en -std=c++98.
+*/
+#if __cplusplus >= 201103L
+#define FT_CONTAINERS_CXX11 1
+#include <utility>
+#endif
+
 namespace ft {
 
     struct nullptr_t {
@@ -35,18 +44,91 @@ namespace ft {
 
 static nullptr_t u_nullptr = {};
 
+/**
+ * @brief Implémentation de ft::distance pour les itérateurs d'entrée :
+ * parcourt l'intervalle.
+ */
 template < class InputIterator >
-typename ft::iterator_traits< InputIterator >::difference_type difference(
-    InputIterator first, InputIterator last) {
-    typedef
-        typename ft::iterator_traits< InputIterator >::difference_type size_type;
-    size_type n = 0;
+typename ft::iterator_traits< InputIterator >::difference_type distance(
+    InputIterator first, InputIterator last, ft::input_iterator_tag) {
+    typename ft::iterator_traits< InputIterator >::difference_type n = 0;
     for (; first != last; ++first) {
         ++n;
     }
     return n;
 }
 
+/**
+ * @brief Implémentation de ft::distance pour les itérateurs
+ * à accès aléatoire : temps constant.
+ */
+template < class RandomAccessIterator >
+typename ft::iterator_traits< RandomAccessIterator >::difference_type distance(
+    RandomAccessIterator first, RandomAccessIterator last,
+    ft::random_access_iterator_tag) {
+    return last - first;
+}
+
+/**
+ * @brief Renvoie le nombre d'éléments entre first et last.
+ * En temps constant pour les itérateurs à accès aléatoire (ft::, std:: et
+ * pointeurs), linéaire sinon.
+ *
+ * @param first Itérateur vers l'élément initial.
+ * @param last Itérateur vers l'élément final.
+ */
+template < class InputIterator >
+typename ft::iterator_traits< InputIterator >::difference_type distance(
+    InputIterator first, InputIterator last) {
+    return ft::distance(first, last,
+                        typename ft::iterator_category_of< InputIterator >::type());
+}
+
+/**
+ * @brief Implémentation de ft::advance pour les itérateurs d'entrée :
+ * n ne peut pas être négatif.
+ */
+template < class InputIterator, class Distance >
+void advance(InputIterator& it, Distance n, ft::input_iterator_tag) {
+    for (; n > 0; --n) {
+        ++it;
+    }
+}
+
+/**
+ * @brief Implémentation de ft::advance pour les itérateurs bidirectionnels.
+ */
+template < class BidirectionalIterator, class Distance >
+void advance(BidirectionalIterator& it, Distance n, ft::bidirectional_iterator_tag) {
+    for (; n > 0; --n) {
+        ++it;
+    }
+    for (; n < 0; ++n) {
+        --it;
+    }
+}
+
+/**
+ * @brief Implémentation de ft::advance pour les itérateurs
+ * à accès aléatoire : temps constant.
+ */
+template < class RandomAccessIterator, class Distance >
+void advance(RandomAccessIterator& it, Distance n, ft::random_access_iterator_tag) {
+    it += n;
+}
+
+/**
+ * @brief Avance l'itérateur it de n positions.
+ *
+ * @param it Itérateur à avancer.
+ * @param n Nombre de positions, négatif seulement pour les itérateurs
+ * bidirectionnels ou à accès aléatoire.
+ */
+template < class InputIterator, class Distance >
+void advance(InputIterator& it, Distance n) {
+    ft::advance(it, n, typename ft::iterator_category_of< InputIterator >::type());
+}
+
 }
 
 #endif
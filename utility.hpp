@@ -13,6 +13,8 @@
 #ifndef _UTILITY_HPP_
 #define _UTILITY_HPP_
 
+#include "type_traits.hpp"
+
 namespace ft {
 
     /**
@@ -48,7 +50,12 @@ namespace ft {
          * d'éléments sont implicitement convertibles en ceux de la paire en cours de construction.
          */
         template < class U, class V >
-        pair(const pair< U, V >& pr) : first(pr.first), second(pr.second){};
+        pair(const pair< U, V >& pr) : first(pr.first), second(pr.second){}
+
+        /**
+         * @brief constructeur par copie
+         */
+        pair(const pair& pr) : first(pr.first), second(pr.second){};
 
 
          /**
@@ -103,6 +110,16 @@ namespace ft {
         return !(lhs < rhs);
     }
 
+    /**
+     * @brief Une paire est relogeable par copie d'octets si ses deux membres
+     * le sont, même si son operator= défini par l'utilisateur l'empêche
+     * d'être trivialement copiable.
+     */
+    template < class T1, class T2 >
+    struct is_trivially_relocatable< pair< T1, T2 > >
+        : public bool_constant< is_trivially_relocatable< T1 >::value &&
+                                is_trivially_relocatable< T2 >::value > {};
+
     /**
      * @brief Exchanges the values of a and b.
      */
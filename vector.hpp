@@ -13,14 +13,19 @@
 #ifndef _VECTOR_HPP_
 #define _VECTOR_HPP_
 
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
 
 #include "algorithm.hpp"
 #include "iterator.hpp"
+#include "memory.hpp"
 #include "random_access_iterator.hpp"
+#include "trace.hpp"
 #include "type_traits.hpp"
 #include "util.hpp"
+#include "utility.hpp"
 
 namespace ft {
     /**
@@ -80,6 +85,12 @@ namespace ft {
             typedef typename allocator_type::size_type size_type;
 
         private:
+            /* Vrai si _reallocate peut confier le bloc à allocator_expansion::reallocate */
+            typedef ft::bool_constant<
+                ft::allocator_expansion< allocator_type >::can_reallocate &&
+                ft::is_trivially_relocatable< value_type >::value >
+                reallocatable;
+
             allocator_type _alloc;
             pointer _start;
             pointer _end;
@@ -128,13 +139,13 @@ namespace ft {
                     const allocator_type& alloc = allocator_type(),
                     typename ft::enable_if<
                         !ft::is_integral< InputIterator >::value >::type* = u_nullptr)
-                : _alloc(alloc) {
-                size_type n = ft::difference(first, last);
-                this->_start = this->_alloc.allocate(n);
-                this->_end_capacity = this->_start + n;
-                this->_end = this->_start;
-                while (n--) this->_alloc.construct(this->_end++, *first++);
-            };
+                : _alloc(alloc),
+                    _start(u_nullptr),
+                    _end(u_nullptr),
+                    _end_capacity(u_nullptr) {
+                this->_range_init(first, last,
+                                typename ft::iterator_category_of< InputIterator >::type());
+            }
 
             /**
              * @brief constructeur par copie
@@ -151,14 +162,59 @@ namespace ft {
                 while (n--) this->_alloc.construct(this->_end++, *other++);
             };
 
+            /**
+             * @brief affectation par copie
+             * Réutilise le stockage courant : les éléments vivants sont
+             * affectés, seule la différence de taille est construite ou
+             * détruite, et le vecteur n'est réalloué (à x.size() exactement)
+             * que si sa capacité ne suffit pas. Un seul memcpy pour les types
+             * trivialement copiables.
+             */
             vector& operator=(const vector& x) {
+                FT_TRACE_SCOPE(COPY_ASSIGN);
                 if (this != &x) {
-                    this->clear();
-                    this->insert(this->_start, x.begin(), x.end());
+                    this->_copy_assign(x, ft::is_trivially_copyable< value_type >());
                 }
                 return *this;
             };
 
+#ifdef FT_CONTAINERS_CXX11
+            /**
+             * @brief constructeur par déplacement
+             * Reprend le stockage de x sans copier ses éléments,
+             * x est laissé vide.
+             */
+            vector(vector&& x) noexcept
+                : _alloc(std::move(x._alloc)),
+                    _start(x._start),
+                    _end(x._end),
+                    _end_capacity(x._end_capacity) {
+                x._start = u_nullptr;
+                x._end = u_nullptr;
+                x._end_capacity = u_nullptr;
+            }
+
+            /**
+             * @brief affectation par déplacement
+             * Libère le contenu courant puis reprend le stockage de x,
+             * x est laissé vide.
+             */
+            vector& operator=(vector&& x) noexcept {
+                if (this != &x) {
+                    this->clear();
+                    this->_alloc.deallocate(this->_start, this->capacity());
+                    this->_alloc = std::move(x._alloc);
+                    this->_start = x._start;
+                    this->_end = x._end;
+                    this->_end_capacity = x._end_capacity;
+                    x._start = u_nullptr;
+                    x._end = u_nullptr;
+                    x._end_capacity = u_nullptr;
+                }
+                return *this;
+            }
+#endif
+
             /**
              * @brief Destructeur de vecteur
              * Détruit l'objet conteneur.
@@ -264,6 +320,13 @@ namespace ft {
              */
             size_type capacity() const { return (this->_end_capacity - this->_start); };
 
+            /**
+             * @brief Nombre d'octets occupés par le tampon du vecteur,
+             * soit sa capacité multipliée par la taille d'un élément. Ne compte
+             * ni l'objet vector lui-même ni la mémoire possédée par les éléments.
+             */
+            size_type memory_footprint() const { return this->capacity() * sizeof(value_type); };
+
             /**
              * @brief Tester si le vecteur est vide
              * Renvoie 1 si le vecteur est vide (c'est-à-dire si sa taille est 0).
@@ -278,29 +341,40 @@ namespace ft {
              * @param n Capacité minimale pour le vecteur.
              */
             void reserve(size_type n) {
+                FT_TRACE_SCOPE(RESERVE);
                 if (n > this->max_size()) {
                     throw std::out_of_range("ft::vector");
                 }
 
-                if (this->capacity() >= n) {
+                if (this->capacity() >= n || this->_expand_in_place(n)) {
                     return;
                 }
 
-                pointer prev_start = this->_start;
-                pointer prev_end = this->_end;
-                size_type prev_capacity = this->capacity();
-
-                this->_start = this->_alloc.allocate(n);
-                this->_end_capacity = this->_start + n;
-                this->_end = this->_start;
+                FT_TRACE_REALLOCATION();
+                this->_reallocate(n);
+            };
 
-                for (pointer target = prev_start; target != prev_end; ++target) {
-                    this->_alloc.construct(this->_end++, *target);
+            /**
+             * @brief Réduit la capacité à la taille
+             * Rend la capacité inutilisée : le vecteur est copié dans un nouveau
+             * bloc au plus juste (l'allocateur peut arrondir la capacité
+             * obtenue), et son stockage est libéré s'il est vide. Un realloc
+             * n'est pas utilisé ici : réduire un grand bloc sur place peut en
+             * garder une page entière.
+             */
+            void shrink_to_fit() {
+                if (this->capacity() == this->size()) {
+                    return;
                 }
-                for (size_type len = prev_end - prev_start; len > 0; --len) {
-                    this->_alloc.destroy(--prev_end);
+                if (this->empty()) {
+                    this->_alloc.deallocate(this->_start, this->capacity());
+                    this->_start = u_nullptr;
+                    this->_end = u_nullptr;
+                    this->_end_capacity = u_nullptr;
+                    return;
                 }
-                this->_alloc.deallocate(prev_start, prev_capacity);
+                FT_TRACE_REALLOCATION();
+                this->_reallocate(this->size(), ft::false_type());
             };
 
             /**
@@ -375,16 +449,10 @@ namespace ft {
                 InputIterator first, InputIterator last,
                 typename ft::enable_if<
                     !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
-                size_type n = ft::difference(first, last);
-                if (this->capacity() < n) {
-                    this->_start = this->_alloc.allocate(n);
-                    this->_end_capacity = this->_start + n;
-                    this->_end = this->_start;
-                } else {
-                    this->clear();
-                }
-                while (n--) this->_alloc.construct(this->_end++, *first++);
-            };
+                FT_TRACE_SCOPE(ASSIGN);
+                this->_range_assign(first, last,
+                                    typename ft::iterator_category_of< InputIterator >::type());
+            }
 
             /**
              * @brief Attribution de contenu vectoriel
@@ -395,15 +463,14 @@ namespace ft {
              * @param val Valeur avec laquelle remplir le conteneur
              */
             void assign(size_type n, const value_type& val) {
+                FT_TRACE_SCOPE(ASSIGN);
+                FT_TRACE_CONSTRUCTED(n);
+                value_type tmp(val);
                 this->clear();
-                if (this->capacity() >= n) {
-                    while (n--) this->_alloc.construct(this->_end++, val);
-                } else {
-                    this->_start = this->_alloc.allocate(n);
-                    this->_end_capacity = this->_start + n;
-                    this->_end = this->_start;
-                    while (n--) this->_alloc.construct(this->_end++, val);
+                if (this->capacity() < n) {
+                    this->reserve(this->_recommend_capacity(n));
                 }
+                while (n--) this->_alloc.construct(this->_end++, tmp);
             };
 
             /**
@@ -412,14 +479,104 @@ namespace ft {
              * @param val : Valeur à copier (ou déplacer) vers le nouvel élément.
              */
             void push_back(const value_type& val) {
+                FT_TRACE_CONSTRUCTED(1);
                 if (this->_end_capacity == this->_end) {
-                    size_type capacity =
-                        (this->size() == 0) ? 1 : (this->_end_capacity - this->_start) * 2;
-                    this->reserve(capacity);
+                    value_type tmp(val);
+                    this->reserve(this->_recommend_capacity(this->size() + 1));
+                    this->_alloc.construct(this->_end++, tmp);
+                    return;
                 }
                 this->_alloc.construct(this->_end++, val);
             };
 
+#ifdef FT_CONTAINERS_CXX11
+            /**
+             * @brief Ajouter un élément à la fin, par déplacement
+             *
+             * @param val : Valeur à déplacer vers le nouvel élément.
+             */
+            void push_back(value_type&& val) { this->emplace_back(std::move(val)); }
+
+            /**
+             * @brief Construire un élément à la fin
+             * L'élément est construit en place à partir de args. En cas de
+             * réallocation, il est construit dans le nouveau stockage avant que
+             * les anciens éléments n'y soient déplacés, args peut donc désigner
+             * un élément du vecteur.
+             *
+             * @param args Arguments transmis au constructeur de value_type.
+             */
+            template < class... Args >
+            void emplace_back(Args&&... args) {
+                FT_TRACE_CONSTRUCTED(1);
+                if (this->_end_capacity != this->_end ||
+                    this->_expand_in_place(this->_recommend_capacity(this->size() + 1))) {
+                    std::allocator_traits< allocator_type >::construct(
+                        this->_alloc, this->_end, std::forward< Args >(args)...);
+                    ++this->_end;
+                    return;
+                }
+                FT_TRACE_REALLOCATION();
+                size_type prev_size = this->size();
+                size_type next_capacity = this->_recommend_capacity(prev_size + 1);
+                if (reallocatable::value) {
+                    /* args peut désigner un élément : copié avant que le bloc ne bouge */
+                    value_type tmp(std::forward< Args >(args)...);
+                    this->_reallocate(next_capacity);
+                    std::allocator_traits< allocator_type >::construct(this->_alloc, this->_end,
+                                                                    std::move(tmp));
+                    ++this->_end;
+                    return;
+                }
+                pointer prev_start = this->_start;
+                size_type prev_capacity = this->capacity();
+
+                pointer next_start = this->_allocate_at_least(next_capacity, next_capacity);
+                std::allocator_traits< allocator_type >::construct(
+                    this->_alloc, next_start + prev_size, std::forward< Args >(args)...);
+                this->_relocate(next_start, prev_start, prev_size);
+                this->_alloc.deallocate(prev_start, prev_capacity);
+
+                this->_start = next_start;
+                this->_end = next_start + prev_size + 1;
+                this->_end_capacity = next_start + next_capacity;
+            }
+
+            /**
+             * @brief Construire un élément à la position donnée
+             *
+             * @param position Position du nouvel élément.
+             * @param args Arguments transmis au constructeur de value_type.
+             * @return iterator Un itérateur vers le nouvel élément.
+             */
+            template < class... Args >
+            iterator emplace(iterator position, Args&&... args) {
+                size_type pos_at = position.base() - this->_start;
+                if (pos_at == this->size()) {
+                    this->emplace_back(std::forward< Args >(args)...);
+                    return this->_start + pos_at;
+                }
+                FT_TRACE_CONSTRUCTED(1);
+                value_type tmp(std::forward< Args >(args)...);
+                pointer gap = this->_make_gap(pos_at, 1);
+                std::allocator_traits< allocator_type >::construct(this->_alloc, gap,
+                                                                std::move(tmp));
+                return gap;
+            }
+
+            /**
+             * @brief Insert élément, par déplacement
+             *
+             * @param position
+             * @param val Valeur à déplacer vers le nouvel élément.
+             * @return itérateur vers l'élément inséré.
+             */
+            iterator insert(iterator position, value_type&& val) {
+                FT_TRACE_SCOPE(INSERT);
+                return this->emplace(position, std::move(val));
+            }
+#endif
+
             /**
              * @brief Supprimer le dernier élément
              * Supprime le dernier élément du vecteur,
@@ -436,7 +593,7 @@ namespace ft {
              * des éléments nouvellement insérés éléments.
              */
             iterator insert(iterator position, const value_type& val) {
-                size_type pos_at = &(*position) - this->_start;
+                size_type pos_at = position.base() - this->_start;
                 this->insert(position, 1, val);
                 return (this->_start + pos_at);
             };
@@ -449,47 +606,16 @@ namespace ft {
              * @param val
              */
             void insert(iterator position, size_type n, const value_type& val) {
-                size_type pos_at = &(*position) - this->_start;
-
-                if (this->capacity() >= this->size() + n) {
-                    for (size_type i = 0; i < this->size() - pos_at; ++i) {
-                        this->_alloc.construct(this->_end + n - i, *(this->_end - i));
-                        this->_alloc.destroy(this->_end - i);
-                    }
-                    this->_end = this->_start + this->size() + n;
-                    for (size_type i = 0; i < n; ++i) {
-                        this->_alloc.construct(this->_start + pos_at + i, val);
-                    }
+                FT_TRACE_SCOPE(INSERT);
+                if (n == 0) {
                     return;
                 }
-
-                size_type next_capacity = this->size() + n;
-
-                pointer prev_start = this->_start;
-                pointer prev_end = this->_end;
-                size_type prev_size = this->size();
-                size_type prev_capacity = this->capacity();
-
-                this->_start = this->_alloc.allocate(next_capacity);
-                this->_end = this->_start + prev_size + n;
-                this->_end_capacity = this->_end;
-
-                for (size_type i = 0; i < pos_at; ++i) {
-                    this->_alloc.construct(this->_start + i, *(prev_start + i));
-                    this->_alloc.destroy(prev_start + i);
-                }
-
-                for (size_type i = 0; i < prev_size - pos_at; ++i) {
-                    this->_alloc.construct(this->_end - i - 1, *(prev_end - i - 1));
-                    this->_alloc.destroy(prev_end - i - 1);
-                }
-
+                FT_TRACE_CONSTRUCTED(n);
+                value_type tmp(val);
+                pointer gap = this->_make_gap(position.base() - this->_start, n);
                 for (size_type i = 0; i < n; ++i) {
-                    this->_alloc.construct(this->_start + pos_at + i, val);
+                    this->_alloc.construct(gap + i, tmp);
                 }
-
-                this->_alloc.deallocate(prev_start, prev_capacity);
-                return;
             };
 
             /**
@@ -505,47 +631,9 @@ namespace ft {
                 iterator position, InputIterator first, InputIterator last,
                 typename ft::enable_if<
                     !ft::is_integral< InputIterator >::value >::type* = u_nullptr) {
-                size_type pos_at = &(*position) - this->_start;
-                size_type n = ft::difference(first, last);
-
-                if (this->capacity() >= this->size() + n) {
-                    for (size_type i = 0; i < this->size() - pos_at; ++i) {
-                        this->_alloc.construct(this->_end + n - i, *(this->_end - i));
-                        this->_alloc.destroy(this->_end - i);
-                    }
-                    this->_end = this->_start + this->size() + n;
-                    for (size_type i = 0; i < n; ++i) {
-                        this->_alloc.construct(this->_start + pos_at + i, *first++);
-                    }
-                    return;
-                }
-
-                size_type next_capacity = this->size() + n;
-
-                pointer prev_start = this->_start;
-                pointer prev_end = this->_end;
-                size_type prev_size = this->size();
-                size_type prev_capacity = this->capacity();
-
-                this->_start = this->_alloc.allocate(next_capacity);
-                this->_end = this->_start + prev_size + n;
-                this->_end_capacity = this->_end;
-
-                for (size_type i = 0; i < pos_at; ++i) {
-                    this->_alloc.construct(this->_start + i, *(prev_start + i));
-                    this->_alloc.destroy(prev_start + i);
-                }
-
-                for (size_type i = 0; i < prev_size - pos_at; ++i) {
-                    this->_alloc.construct(this->_end - i - 1, *(prev_end - i - 1));
-                    this->_alloc.destroy(prev_end - i - 1);
-                }
-
-                for (size_type i = 0; i < n; ++i) {
-                    this->_alloc.construct(this->_start + pos_at + i, *first++);
-                }
-                this->_alloc.deallocate(prev_start, prev_capacity);
-                return;
+                FT_TRACE_SCOPE(INSERT);
+                this->_range_insert(position.base() - this->_start, first, last,
+                                    typename ft::iterator_category_of< InputIterator >::type());
             }
 
             /**
@@ -555,40 +643,34 @@ namespace ft {
              * @return iterator
              */
             iterator erase(iterator position) {
-                size_type pos_at = &(*position) - this->_start;
-                this->_alloc.destroy(&(*position));
-                for (size_type i = 0; i < this->size() - pos_at; ++i) {
-                    this->_alloc.construct(this->_start + pos_at + i,
-                                        *(this->_start + pos_at + i + 1));
-                    this->_alloc.destroy(this->_start + pos_at + i + 1);
-                }
-                --this->_end;
-                return this->_start + pos_at;
+                return this->erase(position, position + 1);
             };
             /**
              * @brief Intervalle, Supprimer des éléments
+             * La fin du vecteur est décalée en une seule passe : un memmove pour
+             * les types trivialement relogeables, des affectations sinon, puis
+             * seuls les derniers emplacements devenus inutiles sont détruits.
              *
              * @param first
              * @param last
              * @return iterator
              */
             iterator erase(iterator first, iterator last) {
-                size_type pos_at = &(*first) - this->_start;
-                size_type n = last - first;
-                for (size_type i = 0; i < n; ++i) {
-                    this->_alloc.destroy(&(*(first + i)));
+                FT_TRACE_SCOPE(ERASE);
+                pointer p_first = first.base();
+                pointer p_last = last.base();
+                if (p_first == p_last) {
+                    return first;
                 }
-                for (size_type i = 0; i < this->size() - pos_at; ++i) {
-                    this->_alloc.construct(this->_start + pos_at + i,
-                                        *(this->_start + pos_at + i + n));
-                    this->_alloc.destroy(this->_start + pos_at + i + n);
-                }
-                this->_end = this->_start + this->size() - n;
-                return this->_start + pos_at;
+                FT_TRACE_DESTROYED(p_last - p_first);
+                this->_erase_shift(p_first, p_last, ft::is_trivially_relocatable< value_type >());
+                return first;
             };
 
             /**
              * @brief Echange de contenu
+             * Les allocateurs sont échangés avec les tampons : chaque vector
+             * garde l'allocateur (arène, statistiques...) qui a fourni sa mémoire.
              *
              * @param x Autre vector;
              */
@@ -596,7 +678,36 @@ namespace ft {
                 if (&x == this) {
                     return;
                 }
+                this->_swap_storage(x);
+                ft::swap(this->_alloc, x._alloc);
+            };
+
+            /**
+             * @brief Effacer le contenu
+             * Supprime tous les éléments du vecteur (qui sont détruits),
+             * laissant le conteneur à taille 0.
+             */
+            void clear() {
+                FT_TRACE_DESTROYED(this->size());
+                while (this->_start != this->_end) {
+                    this->_alloc.destroy(--this->_end);
+                }
+            };
 
+            /**
+             * @brief Obtenir l'objet d'allocation
+             *
+             * @return allocator_type
+             */
+            allocator_type get_allocator() const { return this->_alloc; };
+
+        protected:
+            /**
+             * @brief Échange les tampons sans les allocateurs, pour les
+             * conteneurs dérivés dont l'allocateur est lié à l'objet
+             * (ft::small_vector).
+             */
+            void _swap_storage(vector& x) {
                 pointer start = x._start;
                 pointer end = x._end;
                 pointer end_capacity = x._end_capacity;
@@ -606,25 +717,355 @@ namespace ft {
                 this->_start = start;
                 this->_end = end;
                 this->_end_capacity = end_capacity;
+            }
+
+        private:
+            void _copy_assign(const vector& x, ft::true_type) {
+                size_type n = x.size();
+                FT_TRACE_DESTROYED(this->size());
+                FT_TRACE_CONSTRUCTED(n);
+                if (this->capacity() < n) {
+                    FT_TRACE_REALLOCATION();
+                    /* Vidé avant d'allouer : un échec laisse un vecteur vide valide */
+                    this->_alloc.deallocate(this->_start, this->capacity());
+                    this->_start = u_nullptr;
+                    this->_end = u_nullptr;
+                    this->_end_capacity = u_nullptr;
+                    this->_start = this->_alloc.allocate(n);
+                    this->_end_capacity = this->_start + n;
+                }
+                if (n != 0) {
+                    std::memcpy(static_cast< void* >(this->_start),
+                                static_cast< const void* >(x._start), n * sizeof(value_type));
+                }
+                this->_end = this->_start + n;
+            }
+
+            void _copy_assign(const vector& x, ft::false_type) {
+                size_type n = x.size();
+                if (this->capacity() < n) {
+                    FT_TRACE_REALLOCATION();
+                    FT_TRACE_CONSTRUCTED(n);
+                    pointer next_start = this->_alloc.allocate(n);
+                    pointer next_end = next_start;
+                    try {
+                        for (pointer src = x._start; src != x._end; ++src, ++next_end) {
+                            this->_alloc.construct(next_end, *src);
+                        }
+                    } catch (...) {
+                        /* Le vecteur reste inchangé : on défait la nouvelle copie */
+                        FT_TRACE_DESTROYED(next_end - next_start);
+                        while (next_end != next_start) {
+                            this->_alloc.destroy(--next_end);
+                        }
+                        this->_alloc.deallocate(next_start, n);
+                        throw;
+                    }
+                    this->clear();
+                    this->_alloc.deallocate(this->_start, this->capacity());
+                    this->_start = next_start;
+                    this->_end = next_end;
+                    this->_end_capacity = next_start + n;
+                    return;
+                }
+                size_type common = (this->size() < n) ? this->size() : n;
+                for (size_type i = 0; i < common; ++i) {
+                    this->_start[i] = x._start[i];
+                }
+                FT_TRACE_CONSTRUCTED(n - common);
+                for (pointer src = x._start + common; src != x._end; ++src) {
+                    this->_alloc.construct(this->_end++, *src);
+                }
+                FT_TRACE_DESTROYED(this->size() - n);
+                while (this->size() > n) {
+                    this->_alloc.destroy(--this->_end);
+                }
+            }
+
+            /**
+             * @brief Construction depuis un itérateur d'entrée
+             * L'intervalle ne peut être parcouru qu'une fois : les éléments sont
+             * ajoutés au fil de la lecture, sans calcul préalable de la taille.
+             */
+            template < class InputIterator >
+            void _range_init(InputIterator first, InputIterator last,
+                            ft::input_iterator_tag) {
+                for (; first != last; ++first) {
+                    this->push_back(*first);
+                }
+            }
+
+            /**
+             * @brief Construction depuis un itérateur avant ou plus
+             * La taille est connue avant la copie (en temps constant pour
+             * les itérateurs à accès aléatoire) : une seule allocation exacte.
+             */
+            template < class ForwardIterator >
+            void _range_init(ForwardIterator first, ForwardIterator last,
+                            ft::forward_iterator_tag) {
+                size_type n = ft::distance(first, last);
+                this->_start = this->_alloc.allocate(n);
+                this->_end_capacity = this->_start + n;
+                this->_end = this->_start;
+                while (n--) this->_alloc.construct(this->_end++, *first++);
+            }
+
+            template < class InputIterator >
+            void _range_assign(InputIterator first, InputIterator last,
+                            ft::input_iterator_tag) {
+                this->clear();
+                for (; first != last; ++first) {
+                    this->push_back(*first);
+                }
+            }
+
+            template < class ForwardIterator >
+            void _range_assign(ForwardIterator first, ForwardIterator last,
+                            ft::forward_iterator_tag) {
+                size_type n = ft::distance(first, last);
+                this->clear();
+                if (this->capacity() < n) {
+                    this->reserve(this->_recommend_capacity(n));
+                }
+                FT_TRACE_CONSTRUCTED(n);
+                while (n--) this->_alloc.construct(this->_end++, *first++);
+            }
+
+            /**
+             * @brief Insertion depuis un itérateur d'entrée
+             * En fin de vecteur, les éléments sont ajoutés au fil de la lecture.
+             * Ailleurs, l'intervalle est d'abord lu une seule fois dans un
+             * vecteur temporaire, puis inséré en un seul décalage.
+             */
+            template < class InputIterator >
+            void _range_insert(size_type pos_at, InputIterator first,
+                            InputIterator last, ft::input_iterator_tag) {
+                if (pos_at == this->size()) {
+                    for (; first != last; ++first) {
+                        this->push_back(*first);
+                    }
+                    return;
+                }
+                vector tmp(first, last, this->_alloc);
+                this->_range_insert(pos_at, tmp.begin(), tmp.end(),
+                                    ft::random_access_iterator_tag());
+            }
+
+            template < class ForwardIterator >
+            void _range_insert(size_type pos_at, ForwardIterator first,
+                            ForwardIterator last, ft::forward_iterator_tag) {
+                size_type n = ft::distance(first, last);
+                if (n == 0) {
+                    return;
+                }
+                FT_TRACE_CONSTRUCTED(n);
+                pointer gap = this->_make_gap(pos_at, n);
+                for (size_type i = 0; i < n; ++i) {
+                    this->_alloc.construct(gap + i, *first++);
+                }
+            }
+
+            /**
+             * @brief Politique de croissance
+             * Renvoie la capacité à allouer pour contenir au moins n éléments.
+             * La capacité est au minimum doublée, ce qui garde un coût amorti
+             * constant pour push_back, insert, resize et assign.
+             *
+             * @param n Nombre minimal d'éléments requis.
+             */
+            size_type _recommend_capacity(size_type n) const {
+                const size_type max = this->max_size();
+                if (n > max) {
+                    throw std::out_of_range("ft::vector");
+                }
+                const size_type capacity = this->capacity();
+                if (capacity >= max / 2) {
+                    return max;
+                }
+                return (capacity * 2 > n) ? capacity * 2 : n;
             };
 
             /**
-             * @brief Effacer le contenu
-             * Supprime tous les éléments du vecteur (qui sont détruits),
-             * laissant le conteneur à taille 0.
+             * @brief Tente de porter la capacité à n sans déplacer les éléments,
+             * via ft::allocator_expansion. Renvoie false si l'allocateur ne
+             * sait pas agrandir le bloc courant.
              */
-            void clear() {
-                while (this->_start != this->_end) {
-                    this->_alloc.destroy(--this->_end);
+            bool _expand_in_place(size_type n) {
+                if (this->_start == u_nullptr ||
+                    !ft::allocator_expansion< allocator_type >::try_expand(
+                        this->_alloc, this->_start, this->capacity(), n)) {
+                    return false;
                 }
+                this->_end_capacity = this->_start + n;
+                return true;
             };
 
             /**
-             * @brief Obtenir l'objet d'allocation
+             * @brief Alloue au moins n éléments via ft::allocator_expansion,
+             * count reçoit la capacité obtenue.
+             */
+            pointer _allocate_at_least(size_type n, size_type& count) {
+                return ft::allocator_expansion< allocator_type >::allocate_at_least(this->_alloc, n,
+                                                                                    count);
+            };
+
+            /**
+             * @brief Remplace le stockage par un stockage d'au moins n éléments
+             * (n >= size()), en y déplaçant les éléments. Si l'allocateur sait
+             * réallouer et que les éléments sont trivialement relogeables, le
+             * bloc est confié à allocator_expansion::reallocate, qui peut
+             * l'agrandir ou le réduire sur place.
+             */
+            void _reallocate(size_type n) { this->_reallocate(n, reallocatable()); };
+
+            void _reallocate(size_type n, ft::true_type) {
+                if (this->_start == u_nullptr) {
+                    this->_reallocate(n, ft::false_type());
+                    return;
+                }
+                size_type prev_size = this->size();
+                size_type count;
+                this->_start = ft::allocator_expansion< allocator_type >::reallocate(
+                    this->_alloc, this->_start, this->capacity(), n, count);
+                this->_end = this->_start + prev_size;
+                this->_end_capacity = this->_start + count;
+            };
+
+            void _reallocate(size_type n, ft::false_type) {
+                pointer prev_start = this->_start;
+                size_type prev_size = this->size();
+                size_type prev_capacity = this->capacity();
+                size_type count;
+
+                pointer next_start = this->_allocate_at_least(n, count);
+                this->_relocate(next_start, prev_start, prev_size);
+                this->_alloc.deallocate(prev_start, prev_capacity);
+
+                this->_start = next_start;
+                this->_end = next_start + prev_size;
+                this->_end_capacity = next_start + count;
+            };
+
+            /**
+             * @brief Ouvre un espace de n emplacements non construits à pos_at
+             * Décale la fin du vecteur de n positions, en réallouant selon
+             * _recommend_capacity si la capacité ne suffit pas. La taille est
+             * mise à jour, l'appelant doit construire les n éléments du trou.
              *
-             * @return allocator_type
+             * @param pos_at Indice du premier emplacement du trou.
+             * @param n Nombre d'emplacements à libérer.
+             * @return pointer Le premier emplacement du trou.
              */
-            allocator_type get_allocator() const { return this->_alloc; };
+            pointer _make_gap(size_type pos_at, size_type n) {
+                size_type prev_size = this->size();
+
+                if (this->capacity() >= prev_size + n ||
+                    this->_expand_in_place(this->_recommend_capacity(prev_size + n))) {
+                    this->_relocate(this->_start + pos_at + n, this->_start + pos_at,
+                                    prev_size - pos_at);
+                    this->_end += n;
+                    return this->_start + pos_at;
+                }
+
+                FT_TRACE_REALLOCATION();
+                size_type next_capacity = this->_recommend_capacity(prev_size + n);
+                if (reallocatable::value) {
+                    this->_reallocate(next_capacity);
+                    this->_relocate(this->_start + pos_at + n, this->_start + pos_at,
+                                    prev_size - pos_at);
+                    this->_end += n;
+                    return this->_start + pos_at;
+                }
+
+                pointer prev_start = this->_start;
+                size_type prev_capacity = this->capacity();
+
+                this->_start = this->_allocate_at_least(next_capacity, next_capacity);
+                this->_end = this->_start + prev_size + n;
+                this->_end_capacity = this->_start + next_capacity;
+
+                this->_relocate(this->_start, prev_start, pos_at);
+                this->_relocate(this->_start + pos_at + n, prev_start + pos_at,
+                                prev_size - pos_at);
+                this->_alloc.deallocate(prev_start, prev_capacity);
+                return this->_start + pos_at;
+            };
+
+            /**
+             * @brief Retire [first, last) : les éléments retirés sont détruits puis
+             * la fin du vecteur est ramenée sur eux en un seul memmove.
+             */
+            void _erase_shift(pointer first, pointer last, ft::true_type) {
+                for (pointer p = first; p != last; ++p) {
+                    this->_alloc.destroy(p);
+                }
+                this->_relocate(first, last, this->_end - last);
+                this->_end -= last - first;
+            };
+
+            /**
+             * @brief Retire [first, last) : la fin du vecteur est affectée (déplacée
+             * en C++11) sur les éléments retirés, puis les last - first derniers
+             * emplacements, dont le contenu a été repris, sont détruits.
+             */
+            void _erase_shift(pointer first, pointer last, ft::false_type) {
+                pointer dst = first;
+                for (pointer src = last; src != this->_end; ++src, ++dst) {
+#ifdef FT_CONTAINERS_CXX11
+                    *dst = std::move(*src);
+#else
+                    *dst = *src;
+#endif
+                }
+                while (this->_end != dst) {
+                    this->_alloc.destroy(--this->_end);
+                }
+            };
+
+            /**
+             * @brief Déplace n éléments de src vers dst
+             * Les intervalles peuvent se chevaucher. Après l'appel, [dst, dst + n)
+             * est construit et les emplacements de src qui ne recouvrent pas dst
+             * sont non construits. Les types trivialement relogeables sont
+             * déplacés en un seul memmove.
+             */
+            void _relocate(pointer dst, pointer src, size_type n) {
+                this->_relocate(dst, src, n, ft::is_trivially_relocatable< value_type >());
+            };
+
+            void _relocate(pointer dst, pointer src, size_type n, ft::true_type) {
+                if (n != 0 && dst != src) {
+                    std::memmove(static_cast< void* >(dst), static_cast< const void* >(src),
+                                n * sizeof(value_type));
+                }
+            };
+
+            void _relocate(pointer dst, pointer src, size_type n, ft::false_type) {
+                if (dst < src) {
+                    for (size_type i = 0; i < n; ++i) {
+                        this->_relocate_one(dst + i, src + i);
+                    }
+                } else if (dst > src) {
+                    for (size_type i = n; i > 0; --i) {
+                        this->_relocate_one(dst + i - 1, src + i - 1);
+                    }
+                }
+            };
+
+            /**
+             * @brief Déplace un élément de src vers l'emplacement non construit dst
+             * En C++11, l'élément est déplacé si son constructeur par déplacement
+             * ne peut pas lever d'exception, copié sinon.
+             */
+            void _relocate_one(pointer dst, pointer src) {
+#ifdef FT_CONTAINERS_CXX11
+                std::allocator_traits< allocator_type >::construct(this->_alloc, dst,
+                                                                std::move_if_noexcept(*src));
+#else
+                this->_alloc.construct(dst, *src);
+#endif
+                this->_alloc.destroy(src);
+            };
     };
 
     /**
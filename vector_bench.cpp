@@ -0,0 +1,185 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_bench.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "vector.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+namespace {
+    const std::size_t APPEND_COUNT = 10000000;
+
+    void report(const char* name, double start) {
+        double elapsed_ms = (bench::now_ns() - start) / 1e6;
+        std::cout << "\t " << name << ": " << APPEND_COUNT << " elements, "
+                << bench::alloc_stats::allocations << " allocations, "
+                << elapsed_ms << " ms" << std::endl;
+    }
+
+    template < class Vector >
+    void bench_insert_end(const char* name) {
+        bench::alloc_stats::reset();
+        double start = bench::now_ns();
+        {
+            Vector v;
+            for (std::size_t i = 0; i < APPEND_COUNT; ++i) {
+                v.insert(v.end(), static_cast< int >(i));
+            }
+        }
+        report(name, start);
+    }
+
+    template < class Vector >
+    void bench_insert_end_fill(const char* name) {
+        bench::alloc_stats::reset();
+        double start = bench::now_ns();
+        {
+            Vector v;
+            for (std::size_t i = 0; i < APPEND_COUNT; i += 4) {
+                v.insert(v.end(), 4, static_cast< int >(i));
+            }
+        }
+        report(name, start);
+    }
+
+    template < class Vector >
+    void bench_resize(const char* name) {
+        bench::alloc_stats::reset();
+        double start = bench::now_ns();
+        {
+            Vector v;
+            for (std::size_t i = 1; i <= APPEND_COUNT; ++i) {
+                v.resize(i);
+            }
+        }
+        report(name, start);
+    }
+
+    template < std::size_t Bytes >
+    struct record {
+        char data[Bytes];
+    };
+
+    template < class Vector >
+    void bench_relocation(const char* name) {
+        typedef typename Vector::value_type value_type;
+        const std::size_t count = 1000000;
+        const std::size_t front_count = 20000;
+        value_type r = value_type();
+
+        double start = bench::now_ns();
+        {
+            Vector v;
+            for (std::size_t i = 0; i < count; ++i) {
+                v.push_back(r);
+            }
+            v.reserve(v.capacity() * 2);
+        }
+        double grow_ms = (bench::now_ns() - start) / 1e6;
+
+        start = bench::now_ns();
+        {
+            Vector v;
+            for (std::size_t i = 0; i < front_count; ++i) {
+                v.insert(v.begin(), r);
+            }
+            while (!v.empty()) {
+                v.erase(v.begin());
+            }
+        }
+        double shift_ms = (bench::now_ns() - start) / 1e6;
+
+        std::cout << "\t " << name << " (" << sizeof(value_type) << " bytes): push_back "
+                << grow_ms << " ms, insert/erase front " << shift_ms << " ms"
+                << std::endl;
+    }
+
+    /**
+     * @brief Débit des erase(begin()) successifs sur un vecteur d'un million
+     * d'éléments, en Go/s d'éléments décalés, à comparer au même nombre
+     * d'octets déplacés par un memmove seul.
+     */
+    template < class Vector >
+    void bench_erase_front(const char* name) {
+        typedef typename Vector::value_type value_type;
+        const std::size_t count = 1000000;
+        const std::size_t erase_count = 100;
+
+        Vector v(count, value_type());
+        double bytes = 0;
+        double start = bench::now_ns();
+        for (std::size_t i = 0; i < erase_count; ++i) {
+            v.erase(v.begin());
+            bytes += static_cast< double >(v.size()) * sizeof(value_type);
+        }
+        double elapsed_ns = bench::now_ns() - start;
+
+        std::cout << "\t " << name << " (" << sizeof(value_type) << " bytes): "
+                << elapsed_ns / erase_count / 1e3 << " us per erase, "
+                << bytes / elapsed_ns << " GB/s" << std::endl;
+    }
+
+    template < class T >
+    void bench_memmove_front(void) {
+        const std::size_t count = 1000000;
+        const std::size_t erase_count = 100;
+
+        std::vector< T > buffer(count);
+        std::size_t size = count;
+        double bytes = 0;
+        double start = bench::now_ns();
+        for (std::size_t i = 0; i < erase_count; ++i) {
+            --size;
+            std::memmove(static_cast< void* >(&buffer[0]), static_cast< void* >(&buffer[1]),
+                        size * sizeof(T));
+            bytes += static_cast< double >(size) * sizeof(T);
+        }
+        double elapsed_ns = bench::now_ns() - start;
+
+        std::cout << "\t memmove (" << sizeof(T) << " bytes): "
+                << elapsed_ns / erase_count / 1e3 << " us per erase, "
+                << bytes / elapsed_ns << " GB/s" << std::endl;
+    }
+}
+
+void bench_vector(void) {
+    typedef ft::vector< int, bench::counting_allocator< int > > ft_vector;
+    typedef std::vector< int, bench::counting_allocator< int > > std_vector;
+
+    std::cout << "Bench: vector growth" << std::endl;
+    bench_insert_end< ft_vector >("ft::vector insert(end(), val)");
+    bench_insert_end< std_vector >("std::vector insert(end(), val)");
+    bench_insert_end_fill< ft_vector >("ft::vector insert(end(), 4, val)");
+    bench_insert_end_fill< std_vector >("std::vector insert(end(), 4, val)");
+    bench_resize< ft_vector >("ft::vector resize(size() + 1)");
+    bench_resize< std_vector >("std::vector resize(size() + 1)");
+
+    std::cout << "Bench: vector relocation" << std::endl;
+    bench_relocation< ft::vector< record< 16 > > >("ft::vector");
+    bench_relocation< std::vector< record< 16 > > >("std::vector");
+    bench_relocation< ft::vector< record< 64 > > >("ft::vector");
+    bench_relocation< std::vector< record< 64 > > >("std::vector");
+
+    std::cout << "Bench: vector erase(begin()) on 1M elements" << std::endl;
+    bench_memmove_front< int >();
+    bench_erase_front< ft::vector< int > >("ft::vector");
+    bench_erase_front< std::vector< int > >("std::vector");
+    bench_memmove_front< record< 64 > >();
+    bench_erase_front< ft::vector< record< 64 > > >("ft::vector");
+    bench_erase_front< std::vector< record< 64 > > >("std::vector");
+    bench_erase_front< ft::vector< std::string > >("ft::vector< std::string >");
+    bench_erase_front< std::vector< std::string > >("std::vector< std::string >");
+}
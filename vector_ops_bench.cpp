@@ -0,0 +1,381 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_ops_bench.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdiallo <mdiallo@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:03 by mdiallo           #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:03 by mdiallo          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "algorithm.hpp"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+namespace {
+    /* Nombre d'éléments traités par tour, réparti entre batch() opérations */
+    const std::size_t ELEMENTS_PER_ROUND = 65536;
+
+    struct record64 {
+        char data[64];
+    };
+
+    bool operator==(const record64& lhs, const record64& rhs) {
+        return std::memcmp(lhs.data, rhs.data, sizeof(lhs.data)) == 0;
+    }
+
+    bool operator<(const record64& lhs, const record64& rhs) {
+        return std::memcmp(lhs.data, rhs.data, sizeof(lhs.data)) < 0;
+    }
+
+    /**
+     * @brief Nom et valeurs de test de chaque type d'élément mesuré.
+     */
+    template < class T >
+    struct element;
+
+    template <>
+    struct element< int > {
+        static const char* name() { return "int"; }
+        static int make(std::size_t i) { return static_cast< int >(i); }
+    };
+
+    template <>
+    struct element< double > {
+        static const char* name() { return "double"; }
+        static double make(std::size_t i) { return static_cast< double >(i) * 0.5; }
+    };
+
+    template <>
+    struct element< std::string > {
+        static const char* name() { return "string"; }
+        static std::string make(std::size_t i) {
+            return std::string(8 + i % 16, static_cast< char >('a' + i % 26));
+        }
+    };
+
+    template <>
+    struct element< record64 > {
+        static const char* name() { return "record64"; }
+        static record64 make(std::size_t i) {
+            record64 r;
+            std::memset(r.data, static_cast< int >(i & 0x7f), sizeof(r.data));
+            return r;
+        }
+    };
+
+    enum vector_op_kind {
+        OP_PUSH_BACK,
+        OP_INSERT_MIDDLE,
+        OP_INSERT_FRONT,
+        OP_ERASE_MIDDLE,
+        OP_ERASE_FRONT,
+        OP_RESERVE,
+        OP_COPY,
+        OP_ASSIGN,
+        OP_COPY_ASSIGN,
+        OP_COPY_ASSIGN_REUSE,
+        OP_EQUAL,
+        OP_LESS,
+        OP_ITERATE,
+        OP_REVERSE_ITERATE,
+        OP_COUNT
+    };
+
+    const char* const op_names[OP_COUNT] = {
+        "push_back", "insert_middle", "insert_front", "erase_middle", "erase_front",
+        "reserve_2x", "copy", "assign_range", "operator=", "operator=_reuse", "operator==",
+        "operator<", "iterate", "reverse_iterate"};
+
+    /**
+     * @brief Une opération de Vector sur des vecteurs de n éléments.
+     * setup() prépare hors chronométrage batch() vecteurs indépendants,
+     * run() applique l'opération à chacun.
+     */
+    template < class Vector >
+    class vector_op {
+        public:
+            typedef typename Vector::value_type value_type;
+
+            vector_op(vector_op_kind kind, std::size_t n)
+                : _kind(kind), _n(n), _value(element< value_type >::make(n + 1)), _sink(0) {
+                this->_batch = ELEMENTS_PER_ROUND / n;
+                if (this->_batch == 0) {
+                    this->_batch = 1;
+                }
+                for (std::size_t i = 0; i < n; ++i) {
+                    this->_base.push_back(element< value_type >::make(i));
+                }
+                this->_same = this->_base;
+                for (std::size_t i = 0; i < n / 2; ++i) {
+                    this->_half.push_back(element< value_type >::make(i + 7));
+                }
+            }
+
+            std::size_t batch() const { return this->_batch; }
+
+            /**
+             * @brief Recrée les vecteurs du tour par copie, pour que chacun
+             * reparte de la capacité d'une copie et non de celle laissée
+             * par le tour précédent. Les insertions disposent d'une place
+             * libre : elles mesurent le décalage, pas la réallocation.
+             */
+            void setup() {
+                this->_pool.clear();
+                switch (this->_kind) {
+                    case OP_PUSH_BACK:
+                    case OP_COPY:
+                        this->_pool.resize(this->_batch);
+                        break;
+                    case OP_ASSIGN:
+                    case OP_COPY_ASSIGN:
+                        this->_pool.resize(this->_batch, this->_half);
+                        break;
+                    case OP_INSERT_MIDDLE:
+                    case OP_INSERT_FRONT:
+                        this->_pool.resize(this->_batch, this->_base);
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            this->_pool[b].reserve(this->_n + 1);
+                        }
+                        break;
+                    case OP_EQUAL:
+                    case OP_LESS:
+                    case OP_ITERATE:
+                    case OP_REVERSE_ITERATE:
+                        break;
+                    default:
+                        this->_pool.resize(this->_batch, this->_base);
+                        break;
+                }
+            }
+
+            void run() {
+                std::size_t sink = 0;
+                switch (this->_kind) {
+                    case OP_PUSH_BACK:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            for (std::size_t i = 0; i < this->_n; ++i) {
+                                this->_pool[b].push_back(this->_value);
+                            }
+                        }
+                        break;
+                    case OP_INSERT_MIDDLE:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            Vector& v = this->_pool[b];
+                            v.insert(v.begin() + v.size() / 2, this->_value);
+                        }
+                        break;
+                    case OP_INSERT_FRONT:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            this->_pool[b].insert(this->_pool[b].begin(), this->_value);
+                        }
+                        break;
+                    case OP_ERASE_MIDDLE:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            Vector& v = this->_pool[b];
+                            v.erase(v.begin() + v.size() / 2);
+                        }
+                        break;
+                    case OP_ERASE_FRONT:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            this->_pool[b].erase(this->_pool[b].begin());
+                        }
+                        break;
+                    case OP_RESERVE:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            this->_pool[b].reserve(this->_n * 2);
+                        }
+                        break;
+                    case OP_COPY:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            Vector copy(this->_base);
+                            this->_pool[b].swap(copy);
+                        }
+                        break;
+                    case OP_ASSIGN:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            this->_pool[b].assign(this->_base.begin(), this->_base.end());
+                        }
+                        break;
+                    case OP_COPY_ASSIGN:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            this->_pool[b] = this->_base;
+                        }
+                        break;
+                    case OP_COPY_ASSIGN_REUSE:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            this->_pool[b] = this->_same;
+                        }
+                        break;
+                    case OP_EQUAL:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            sink += (this->_base == this->_same);
+                        }
+                        break;
+                    case OP_LESS:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            sink += (this->_base < this->_same);
+                        }
+                        break;
+                    case OP_ITERATE:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            for (typename Vector::const_iterator it = this->_base.begin();
+                                it != this->_base.end(); ++it) {
+                                sink += (*it == this->_value);
+                            }
+                        }
+                        break;
+                    case OP_REVERSE_ITERATE:
+                        for (std::size_t b = 0; b < this->_batch; ++b) {
+                            for (typename Vector::const_reverse_iterator it = this->_base.rbegin();
+                                it != this->_base.rend(); ++it) {
+                                sink += (*it == this->_value);
+                            }
+                        }
+                        break;
+                    default:
+                        break;
+                }
+                this->_sink += sink;
+            }
+
+            std::size_t sink() const { return this->_sink; }
+
+        private:
+            vector_op_kind _kind;
+            std::size_t _n;
+            std::size_t _batch;
+            value_type _value;
+            Vector _base;
+            Vector _same;
+            Vector _half;
+            std::vector< Vector > _pool;
+            std::size_t _sink;
+    };
+
+    enum algorithm_kind { ALGO_EQUAL, ALGO_LEXICOGRAPHICAL_COMPARE, ALGO_COUNT };
+
+    const char* const algorithm_names[ALGO_COUNT] = {"equal", "lexicographical_compare"};
+
+    /**
+     * @brief ft::equal / ft::lexicographical_compare sur deux ft::vector
+     * identiques, ou leurs équivalents std:: sur deux std::vector : tout
+     * l'intervalle est parcouru.
+     */
+    template < class T, bool Ft >
+    class algorithm_op {
+        public:
+            typedef typename ft::conditional< Ft, ft::vector< T >, std::vector< T > >::type
+                vector_type;
+
+            algorithm_op(algorithm_kind kind, std::size_t n) : _kind(kind), _sink(0) {
+                this->_batch = ELEMENTS_PER_ROUND / n;
+                if (this->_batch == 0) {
+                    this->_batch = 1;
+                }
+                for (std::size_t i = 0; i < n; ++i) {
+                    this->_a.push_back(element< T >::make(i));
+                    this->_b.push_back(element< T >::make(i));
+                }
+            }
+
+            std::size_t batch() const { return this->_batch; }
+
+            void setup() {}
+
+            void run() {
+                std::size_t sink = 0;
+                for (std::size_t i = 0; i < this->_batch; ++i) {
+                    sink += this->_call(ft::bool_constant< Ft >());
+                }
+                this->_sink += sink;
+            }
+
+            std::size_t sink() const { return this->_sink; }
+
+        private:
+            algorithm_kind _kind;
+            std::size_t _batch;
+            vector_type _a;
+            vector_type _b;
+            std::size_t _sink;
+
+            bool _call(ft::true_type) const {
+                if (this->_kind == ALGO_EQUAL) {
+                    return ft::equal(this->_a.begin(), this->_a.end(), this->_b.begin());
+                }
+                return ft::lexicographical_compare(this->_a.begin(), this->_a.end(),
+                                                this->_b.begin(), this->_b.end());
+            }
+
+            bool _call(ft::false_type) const {
+                if (this->_kind == ALGO_EQUAL) {
+                    return std::equal(this->_a.begin(), this->_a.end(), this->_b.begin());
+                }
+                return std::lexicographical_compare(this->_a.begin(), this->_a.end(),
+                                                    this->_b.begin(), this->_b.end());
+            }
+    };
+
+    template < class Op >
+    std::size_t run_case(bench::csv_writer& csv, const char* suite, const char* name,
+                        const char* library, const char* type, std::size_t n, Op& op) {
+        bench::summary s = bench::measure(op);
+        csv.row(suite, name, library, type, n, s);
+        return op.sink();
+    }
+
+    template < class T >
+    std::size_t bench_element(bench::csv_writer& csv, std::size_t n) {
+        const char* type = element< T >::name();
+        std::size_t sink = 0;
+        for (int kind = 0; kind < OP_COUNT; ++kind) {
+            vector_op< ft::vector< T > > ft_op(static_cast< vector_op_kind >(kind), n);
+            vector_op< std::vector< T > > std_op(static_cast< vector_op_kind >(kind), n);
+            sink += run_case(csv, "vector", op_names[kind], "ft", type, n, ft_op);
+            sink += run_case(csv, "vector", op_names[kind], "std", type, n, std_op);
+        }
+        for (int kind = 0; kind < ALGO_COUNT; ++kind) {
+            algorithm_op< T, true > ft_op(static_cast< algorithm_kind >(kind), n);
+            algorithm_op< T, false > std_op(static_cast< algorithm_kind >(kind), n);
+            sink += run_case(csv, "algorithm", algorithm_names[kind], "ft", type, n, ft_op);
+            sink += run_case(csv, "algorithm", algorithm_names[kind], "std", type, n, std_op);
+        }
+        return sink;
+    }
+}
+
+/**
+ * @brief Chaque opération de ft::vector et chaque algorithme, face à son
+ * équivalent std::, pour plusieurs types d'éléments et tailles : 3 tours
+ * d'échauffement, 31 tours mesurés, médiane et p99 du temps par opération
+ * écrits en CSV dans out. push_back, les parcours et les comparaisons
+ * portent sur les n éléments, les autres opérations sur un seul.
+ */
+void bench_vector_ops(std::ostream& out) {
+    const std::size_t sizes[] = {16, 1024, 65536};
+
+    std::cout << "Bench: vector operations and algorithms vs std:: (CSV)" << std::endl;
+    bench::csv_writer csv(out);
+    csv.header();
+    std::size_t sink = 0;
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        sink += bench_element< int >(csv, sizes[i]);
+        sink += bench_element< double >(csv, sizes[i]);
+        sink += bench_element< std::string >(csv, sizes[i]);
+        sink += bench_element< record64 >(csv, sizes[i]);
+    }
+    out.flush();
+    if (sink == static_cast< std::size_t >(-1)) {
+        std::cout << std::endl;
+    }
+}
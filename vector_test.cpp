@@ -15,9 +15,382 @@
 #include <cassert>
 #include <iostream>
 #include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
+void test_vector_growth(void) {
+    std::cout << "\t growth" << std::endl;
+
+    ft::vector< int > ft_insert;
+    std::vector< int > std_insert;
+    size_t reallocations = 0;
+    for (int i = 0; i < 1000; ++i) {
+        size_t prev_capacity = ft_insert.capacity();
+        ft_insert.insert(ft_insert.end(), i);
+        std_insert.insert(std_insert.end(), i);
+        if (ft_insert.capacity() != prev_capacity) {
+            ++reallocations;
+        }
+    }
+    assert(reallocations <= 11);
+
+    ft_insert.insert(ft_insert.begin() + 10, 3, -1);
+    std_insert.insert(std_insert.begin() + 10, 3, -1);
+    ft_insert.insert(ft_insert.begin(), std_insert.begin(), std_insert.begin() + 5);
+    std_insert.insert(std_insert.begin(), std_insert.begin(), std_insert.begin() + 5);
+    assert(ft_insert.size() == std_insert.size());
+    for (size_t i = 0; i < std_insert.size(); ++i) {
+        assert(ft_insert[i] == std_insert[i]);
+    }
+
+    ft::vector< std::string > ft_resize;
+    reallocations = 0;
+    for (size_t i = 1; i <= 1000; ++i) {
+        size_t prev_capacity = ft_resize.capacity();
+        ft_resize.resize(i, "x");
+        if (ft_resize.capacity() != prev_capacity) {
+            ++reallocations;
+        }
+    }
+    assert(reallocations <= 11);
+    assert(ft_resize.size() == 1000 && ft_resize.back() == "x");
+
+    ft_resize.assign(3000, "y");
+    assert(ft_resize.size() == 3000 && ft_resize.front() == "y");
+}
+
+namespace {
+    struct record {
+        long id;
+        double values[3];
+    };
+
+    struct handle {
+        int* ptr;
+        handle() : ptr(ft::u_nullptr) {}
+        handle(const handle& other) : ptr(other.ptr) {}
+        handle& operator=(const handle& other) {
+            ptr = other.ptr;
+            return *this;
+        }
+    };
+}
+
+namespace ft {
+    template <>
+    struct is_trivially_relocatable< handle > : public true_type {};
+}
+
+void test_vector_relocation(void) {
+    std::cout << "\t relocation" << std::endl;
+
+    assert(ft::is_trivially_relocatable< int >::value);
+    assert(ft::is_trivially_relocatable< double >::value);
+    assert(ft::is_trivially_relocatable< record >::value);
+    assert(ft::is_trivially_relocatable< handle >::value);
+    assert(!ft::is_trivially_relocatable< std::string >::value);
+
+    ft::vector< record > ft_records;
+    std::vector< record > std_records;
+    for (long i = 0; i < 100; ++i) {
+        record r = {i, {i * 0.5, i * 1.5, i * 2.5}};
+        ft_records.insert(ft_records.begin() + i / 2, r);
+        std_records.insert(std_records.begin() + i / 2, r);
+    }
+    ft_records.erase(ft_records.begin() + 10, ft_records.begin() + 30);
+    std_records.erase(std_records.begin() + 10, std_records.begin() + 30);
+    ft_records.erase(ft_records.begin());
+    std_records.erase(std_records.begin());
+    assert(ft_records.size() == std_records.size());
+    for (size_t i = 0; i < std_records.size(); ++i) {
+        assert(ft_records[i].id == std_records[i].id);
+        assert(ft_records[i].values[2] == std_records[i].values[2]);
+    }
+
+    ft::vector< std::string > ft_strings;
+    std::vector< std::string > std_strings;
+    for (int i = 0; i < 50; ++i) {
+        std::string str(static_cast< size_t >(i) + 20, static_cast< char >('a' + i % 26));
+        ft_strings.insert(ft_strings.begin() + i / 3, str);
+        std_strings.insert(std_strings.begin() + i / 3, str);
+    }
+    ft_strings.erase(ft_strings.begin() + 5, ft_strings.begin() + 15);
+    std_strings.erase(std_strings.begin() + 5, std_strings.begin() + 15);
+    ft_strings.reserve(200);
+    assert(ft_strings.size() == std_strings.size());
+    for (size_t i = 0; i < std_strings.size(); ++i) {
+        assert(ft_strings[i] == std_strings[i]);
+    }
+}
+
+namespace {
+    struct counted {
+        static int live;
+        static int assignments;
+        int value;
+        counted(int v) : value(v) { ++live; }
+        counted(const counted& other) : value(other.value) { ++live; }
+        ~counted() { --live; }
+        counted& operator=(const counted& other) {
+            value = other.value;
+            ++assignments;
+            return *this;
+        }
+    };
+    int counted::live = 0;
+    int counted::assignments = 0;
+
+    /**
+     * @brief Élément dont la copie lève une exception après copies_left copies.
+     */
+    struct throwing_copy {
+        static int copies_left;
+        std::string text;
+        explicit throwing_copy(const std::string& t) : text(t) {}
+        throwing_copy(const throwing_copy& other) : text(other.text) {
+            if (copies_left-- == 0) {
+                throw std::runtime_error("copy");
+            }
+        }
+        throwing_copy& operator=(const throwing_copy& other) {
+            text = other.text;
+            return *this;
+        }
+    };
+    int throwing_copy::copies_left = -1;
+}
+
+void test_vector_erase(void) {
+    std::cout << "\t erase" << std::endl;
+
+    {
+        ft::vector< counted > values;
+        for (int i = 0; i < 10; ++i) {
+            values.push_back(counted(i));
+        }
+        assert(counted::live == 10);
+
+        counted::assignments = 0;
+        ft::vector< counted >::iterator it = values.erase(values.begin() + 2, values.begin() + 5);
+        assert(it == values.begin() + 2 && it->value == 5);
+        assert(counted::live == 7 && counted::assignments == 5);
+        int expected[] = {0, 1, 5, 6, 7, 8, 9};
+        for (size_t i = 0; i < values.size(); ++i) {
+            assert(values[i].value == expected[i]);
+        }
+
+        counted::assignments = 0;
+        values.erase(values.end() - 1);
+        assert(counted::live == 6 && counted::assignments == 0);
+        values.erase(values.begin() + 1, values.begin() + 1);
+        assert(counted::live == 6 && values.size() == 6);
+        values.erase(values.begin(), values.end());
+        assert(counted::live == 0 && values.empty());
+    }
+    assert(counted::live == 0);
+
+    ft::vector< int > ints;
+    std::vector< int > std_ints;
+    for (int i = 0; i < 100; ++i) {
+        ints.push_back(i);
+        std_ints.push_back(i);
+    }
+    while (!std_ints.empty()) {
+        size_t at = std_ints.size() / 3;
+        size_t n = std_ints.size() - at < 4 ? std_ints.size() - at : 4;
+        ints.erase(ints.begin() + at, ints.begin() + at + n);
+        std_ints.erase(std_ints.begin() + at, std_ints.begin() + at + n);
+        assert(ints.size() == std_ints.size());
+        for (size_t i = 0; i < std_ints.size(); ++i) {
+            assert(ints[i] == std_ints[i]);
+        }
+    }
+}
+
+void test_vector_copy_assign(void) {
+    std::cout << "\t copy assignment" << std::endl;
+
+    ft::vector< int > ints(100, 1);
+    const int* buffer = &ints[0];
+    ft::vector< int > small(10, 2);
+    ints = small;
+    assert(ints.size() == 10 && ints.capacity() == 100 && &ints[0] == buffer);
+    assert(ints[0] == 2 && ints[9] == 2);
+    ft::vector< int > large(300, 3);
+    ints = large;
+    assert(ints.size() == 300 && ints.capacity() == 300 && ints[299] == 3);
+    ft::vector< int > empty;
+    ints = empty;
+    assert(ints.empty() && ints.capacity() == 300);
+
+    {
+        ft::vector< counted > values;
+        values.reserve(20);
+        for (int i = 0; i < 8; ++i) {
+            values.push_back(counted(i));
+        }
+        ft::vector< counted > shorter;
+        for (int i = 0; i < 5; ++i) {
+            shorter.push_back(counted(i + 100));
+        }
+        const counted* data = &values[0];
+
+        counted::assignments = 0;
+        values = shorter;
+        assert(counted::assignments == 5 && counted::live == 10);
+        assert(values.size() == 5 && &values[0] == data && values[4].value == 104);
+
+        ft::vector< counted > longer(12, counted(7));
+        counted::assignments = 0;
+        values = longer;
+        assert(counted::assignments == 5 && counted::live == 29);
+        assert(values.size() == 12 && &values[0] == data && values[11].value == 7);
+
+        ft::vector< counted > huge(30, counted(9));
+        values = huge;
+        assert(values.size() == 30 && values.capacity() == 30 && counted::live == 77);
+        ft::vector< counted >& self = values;
+        values = self;
+        assert(values.size() == 30 && values[29].value == 9);
+    }
+    assert(counted::live == 0);
+
+    ft::vector< std::string > strings(3, "abc");
+    ft::vector< std::string > other(5, "defgh");
+    strings = other;
+    assert(strings.size() == 5 && strings[4] == "defgh");
+    other.resize(1);
+    strings = other;
+    assert(strings.size() == 1 && strings[0] == "defgh");
+
+    /* Copie qui échoue pendant la réallocation : ni fuite, ni changement */
+    ft::vector< throwing_copy > source(10, throwing_copy(std::string(40, 's')));
+    ft::vector< throwing_copy > target(2, throwing_copy("kept"));
+    throwing_copy::copies_left = 4;
+    bool thrown = false;
+    try {
+        target = source;
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    throwing_copy::copies_left = -1;
+    assert(thrown && target.size() == 2 && target.capacity() == 2 && target[1].text == "kept");
+}
+
+void test_vector_shrink_to_fit(void) {
+    std::cout << "\t shrink_to_fit" << std::endl;
+
+    ft::vector< int > ints;
+    for (int i = 0; i < 100; ++i) {
+        ints.push_back(i);
+    }
+    ints.erase(ints.begin() + 10, ints.end());
+    ints.shrink_to_fit();
+    assert(ints.size() == 10 && ints.capacity() == 10);
+    assert(ints[0] == 0 && ints[9] == 9);
+    ints.shrink_to_fit();
+    assert(ints.capacity() == 10);
+    ints.clear();
+    ints.shrink_to_fit();
+    assert(ints.capacity() == 0 && ints.begin() == ints.end());
+    ints.push_back(1);
+    assert(ints.size() == 1 && ints[0] == 1);
+
+    ft::vector< std::string > strings(50, "shrink");
+    strings.reserve(200);
+    strings.resize(3);
+    strings.shrink_to_fit();
+    assert(strings.capacity() == 3 && strings[2] == "shrink");
+}
+
+void test_vector_input_iterator(void) {
+    std::cout << "\t input iterator" << std::endl;
+
+    std::istringstream ctor_stream("1 2 3 4 5");
+    ft::vector< int > ft_stream((std::istream_iterator< int >(ctor_stream)),
+                                std::istream_iterator< int >());
+    assert(ft_stream.size() == 5 && ft_stream.front() == 1 && ft_stream.back() == 5);
+
+    std::istringstream insert_stream("7 8 9");
+    ft_stream.insert(ft_stream.begin() + 1, std::istream_iterator< int >(insert_stream),
+                    std::istream_iterator< int >());
+    int expected[] = {1, 7, 8, 9, 2, 3, 4, 5};
+    assert(ft_stream.size() == 8);
+    for (size_t i = 0; i < ft_stream.size(); ++i) {
+        assert(ft_stream[i] == expected[i]);
+    }
+
+    std::istringstream assign_stream("42 43");
+    ft_stream.assign(std::istream_iterator< int >(assign_stream),
+                    std::istream_iterator< int >());
+    assert(ft_stream.size() == 2 && ft_stream[0] == 42 && ft_stream[1] == 43);
+
+    ft::vector< int > ft_range(expected, expected + 8);
+    assert(ft_range.size() == 8 && ft_range.capacity() == 8);
+}
+
+#ifdef FT_CONTAINERS_CXX11
+namespace {
+    struct throwing_move {
+        static int copies;
+        int value;
+        explicit throwing_move(int v) : value(v) {}
+        throwing_move(const throwing_move& other) : value(other.value) { ++copies; }
+        throwing_move(throwing_move&& other) : value(other.value) {}
+    };
+    int throwing_move::copies = 0;
+}
+
+void test_vector_move(void) {
+    std::cout << "\t move" << std::endl;
+
+    ft::vector< ft::vector< int > > nested;
+    nested.push_back(ft::vector< int >(100, 7));
+    const int* inner = &nested[0][0];
+    for (int i = 0; i < 100; ++i) {
+        nested.emplace_back(10, i);
+    }
+    assert(&nested[0][0] == inner);
+    assert(nested.size() == 101 && nested[100].size() == 10 && nested[100][0] == 99);
+
+    ft::vector< ft::vector< int > > moved(std::move(nested));
+    assert(nested.empty() && nested.capacity() == 0);
+    assert(moved.size() == 101 && &moved[0][0] == inner);
+
+    nested = std::move(moved);
+    assert(moved.empty() && nested.size() == 101 && &nested[0][0] == inner);
+
+    ft::vector< std::string > strings;
+    strings.emplace_back(3, 'a');
+    strings.emplace(strings.begin(), "first");
+    std::string str("moved");
+    strings.insert(strings.begin() + 1, std::move(str));
+    strings.push_back(std::string("last"));
+    strings.emplace_back(strings[0]);
+    assert(strings.size() == 5);
+    assert(strings[0] == "first" && strings[1] == "moved" && strings[2] == "aaa");
+    assert(strings[3] == "last" && strings[4] == "first");
+
+    ft::vector< std::unique_ptr< int > > owners;
+    for (int i = 0; i < 20; ++i) {
+        owners.emplace_back(new int(i));
+    }
+    owners.erase(owners.begin() + 5);
+    assert(owners.size() == 19 && *owners[5] == 6 && *owners[18] == 19);
+
+    ft::vector< throwing_move > safe;
+    for (int i = 0; i < 10; ++i) {
+        safe.emplace_back(i);
+    }
+    throwing_move::copies = 0;
+    safe.reserve(100);
+    assert(throwing_move::copies == 10 && safe[9].value == 9);
+}
+#endif
+
 void test_vector(void) {
     int arr[] = {0, 1, 2, 3, 4, 5, 6, 7, 7, 8, 9, 10};
 
@@ -58,4 +431,14 @@ void test_vector(void) {
 
     ft_default.reserve(100);
     assert(ft_default.capacity() == 100);
+
+    test_vector_growth();
+    test_vector_relocation();
+    test_vector_erase();
+    test_vector_copy_assign();
+    test_vector_shrink_to_fit();
+    test_vector_input_iterator();
+#ifdef FT_CONTAINERS_CXX11
+    test_vector_move();
+#endif
 }